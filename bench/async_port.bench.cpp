@@ -0,0 +1,395 @@
+// Fan-in check for the coroutine layer: one IoContext thread serves kPorts AsyncPort pumps over an
+// in-process stub of the serial.h poll/read calls. Each port receives COBS frames cut into random chunks,
+// delivered one chunk per serialPoll() round in random port order. Every pump decodes with
+// decodedFrames() and checks the payloads; a second phase checks readUntil() against a terminator split
+// across chunks (bytes after it must stay queued), readiness timeouts, and cancel() from another thread.
+// Exits non-zero on any mismatch.
+
+#include "cpp_core/async_port.hpp"
+#include "cpp_core/cobs.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t kPorts = 2000;
+constexpr std::size_t kFramesPerPort = 40;
+constexpr std::int64_t kFirstHandle = 1;
+
+struct Rng
+{
+    std::uint64_t state;
+
+    auto next() -> std::uint64_t
+    {
+        state ^= state << 13U;
+        state ^= state >> 7U;
+        state ^= state << 17U;
+        return state;
+    }
+
+    auto below(std::size_t bound) -> std::size_t
+    {
+        return static_cast<std::size_t>(next() % bound);
+    }
+};
+
+struct FakePort
+{
+    std::deque<std::byte> rx;
+};
+
+struct Delivery
+{
+    std::size_t port;
+    std::vector<std::byte> bytes;
+};
+
+std::vector<FakePort> g_ports;
+std::deque<Delivery> g_schedule;
+std::size_t g_polls = 0;
+
+std::mutex g_abort_mutex;
+std::condition_variable g_abort_cv;
+bool g_aborted = false;
+
+auto portOf(std::int64_t handle) -> FakePort *
+{
+    const auto index = static_cast<std::size_t>(handle - kFirstHandle);
+    return handle >= kFirstHandle && index < g_ports.size() ? &g_ports[index] : nullptr;
+}
+
+auto copyOut(FakePort &port, void *buffer, int buffer_size, bool consume) -> int
+{
+    const auto count = std::min(port.rx.size(), static_cast<std::size_t>(buffer_size));
+    std::copy_n(port.rx.begin(), count, static_cast<std::byte *>(buffer));
+    if (consume)
+    {
+        port.rx.erase(port.rx.begin(), port.rx.begin() + static_cast<std::ptrdiff_t>(count));
+    }
+    return static_cast<int>(count);
+}
+
+auto invalidHandle(ErrorCallbackT error_callback) -> int
+{
+    if (error_callback != nullptr)
+    {
+        error_callback(static_cast<int>(cpp_core::StatusCode::Connection::kInvalidHandleError), "no such port");
+    }
+    return static_cast<int>(cpp_core::StatusCode::Connection::kInvalidHandleError);
+}
+
+} // namespace
+
+extern "C"
+{
+
+    auto serialClose(int64_t /*handle*/, ErrorCallbackT /*error_callback*/) -> int
+    {
+        return 0;
+    }
+
+    auto serialRead(int64_t handle, void *buffer, int buffer_size, int /*timeout_ms*/, int /*multiplier*/,
+                    ErrorCallbackT error_callback) -> int
+    {
+        auto *port = portOf(handle);
+        return port == nullptr ? invalidHandle(error_callback) : copyOut(*port, buffer, buffer_size, true);
+    }
+
+    auto serialPeek(int64_t handle, void *buffer, int buffer_size, int /*timeout_ms*/, ErrorCallbackT error_callback)
+        -> int
+    {
+        auto *port = portOf(handle);
+        return port == nullptr ? invalidHandle(error_callback) : copyOut(*port, buffer, buffer_size, false);
+    }
+
+    auto serialAbortRead(int64_t /*handle*/, ErrorCallbackT /*error_callback*/) -> int
+    {
+        {
+            const std::scoped_lock lock(g_abort_mutex);
+            g_aborted = true;
+        }
+        g_abort_cv.notify_all();
+        return 0;
+    }
+
+    // Level-triggered like the real bindings. When nothing is ready, one scheduled chunk "arrives"; once the
+    // schedule is empty the call blocks until its timeout or serialAbortRead().
+    auto serialPoll(cpp_core::PollEntry *entries, int entry_count, int timeout_ms, ErrorCallbackT /*error_callback*/)
+        -> int
+    {
+        ++g_polls;
+        const std::span poll_entries(entries, static_cast<std::size_t>(entry_count));
+        const auto mark = [&] {
+            int ready = 0;
+            for (auto &entry : poll_entries)
+            {
+                const auto *port = portOf(entry.handle);
+                entry.revents = port == nullptr         ? cpp_core::toInt(cpp_core::PollEvent::kInvalid)
+                                : port->rx.empty() ? 0
+                                                   : cpp_core::toInt(cpp_core::PollEvent::kReadable);
+                ready += entry.revents != 0 ? 1 : 0;
+            }
+            return ready;
+        };
+        if (const auto ready = mark(); ready != 0)
+        {
+            return ready;
+        }
+        if (!g_schedule.empty())
+        {
+            auto &delivery = g_schedule.front();
+            g_ports[delivery.port].rx.insert(g_ports[delivery.port].rx.end(), delivery.bytes.begin(),
+                                             delivery.bytes.end());
+            g_schedule.pop_front();
+            return mark();
+        }
+        std::unique_lock lock(g_abort_mutex);
+        const auto woken = [] { return g_aborted; };
+        if (timeout_ms < 0)
+        {
+            g_abort_cv.wait(lock, woken);
+        }
+        else
+        {
+            g_abort_cv.wait_for(lock, std::chrono::milliseconds{timeout_ms}, woken);
+        }
+        g_aborted = false;
+        return 0;
+    }
+
+} // extern "C"
+
+namespace
+{
+
+using cpp_core::AsyncPort;
+using cpp_core::IoContext;
+using cpp_core::Result;
+using cpp_core::SerialPort;
+using cpp_core::Task;
+using cpp_core::TimeoutMs;
+
+auto payloadOf(std::size_t port, std::size_t frame) -> std::vector<std::byte>
+{
+    std::vector<std::byte> payload(1 + (port * 7 + frame * 13) % 60);
+    for (std::size_t i = 0; i < payload.size(); ++i)
+    {
+        payload[i] = static_cast<std::byte>((port + frame + i) % 5 == 0 ? 0 : (port ^ (frame * 31) ^ i) & 0xFFU);
+    }
+    return payload;
+}
+
+auto encodedStream(std::size_t port) -> std::vector<std::byte>
+{
+    std::vector<std::byte> stream;
+    for (std::size_t frame = 0; frame < kFramesPerPort; ++frame)
+    {
+        const auto payload = payloadOf(port, frame);
+        std::vector<std::byte> encoded(cpp_core::cobsMaxEncodedSize(payload.size()));
+        cpp_core::CobsEncoder encoder;
+        const auto body = encoder.encode(payload, encoded);
+        const auto tail = encoder.finish(std::span(encoded).subspan(body.produced));
+        const auto produced = static_cast<std::ptrdiff_t>(body.produced + tail.produced);
+        stream.insert(stream.end(), encoded.begin(), encoded.begin() + produced);
+    }
+    return stream;
+}
+
+struct PumpStats
+{
+    std::size_t frames = 0;
+    std::size_t mismatches = 0;
+    std::size_t reads = 0;
+};
+
+auto pump(IoContext &context, SerialPort &port, std::size_t index, PumpStats &stats) -> Task<>
+{
+    AsyncPort async{context, port};
+    std::array<std::byte, 48> rx{};
+    std::array<std::byte, 128> frame{};
+    cpp_core::CobsDecoder decoder;
+    std::size_t seen = 0;
+    while (seen < kFramesPerPort)
+    {
+        const auto got = co_await async.read(rx);
+        ++stats.reads;
+        if (!got)
+        {
+            ++stats.mismatches;
+            co_return;
+        }
+        for (const auto packet : cpp_core::decodedFrames(decoder, std::span(rx).first(*got), frame))
+        {
+            const auto expected = payloadOf(index, seen++);
+            if (!std::ranges::equal(packet, expected))
+            {
+                ++stats.mismatches;
+            }
+            ++stats.frames;
+        }
+    }
+}
+
+auto check(bool condition, const char *what, int &failures) -> void
+{
+    if (!condition)
+    {
+        std::printf("FAIL: %s\n", what);
+        ++failures;
+    }
+}
+
+auto bytesOf(std::string_view text) -> std::vector<std::byte>
+{
+    const auto bytes = std::as_bytes(std::span(text));
+    return {bytes.begin(), bytes.end()};
+}
+
+auto fanIn(int &failures) -> void
+{
+    g_ports.assign(kPorts, {});
+    Rng rng{0x243F6A8885A308D3ULL};
+    std::vector<std::deque<Delivery>> per_port(kPorts);
+    for (std::size_t port = 0; port < kPorts; ++port)
+    {
+        const auto stream = encodedStream(port);
+        for (std::size_t offset = 0; offset < stream.size();)
+        {
+            const auto size = std::min(stream.size() - offset, 1 + rng.below(96));
+            per_port[port].push_back({port, {stream.begin() + static_cast<std::ptrdiff_t>(offset),
+                                             stream.begin() + static_cast<std::ptrdiff_t>(offset + size)}});
+            offset += size;
+        }
+    }
+    // Interleave: repeatedly pick a random port that still has chunks, preserving per-port order.
+    std::vector<std::size_t> live(kPorts);
+    for (std::size_t port = 0; port < kPorts; ++port)
+    {
+        live[port] = port;
+    }
+    while (!live.empty())
+    {
+        const auto pick = rng.below(live.size());
+        auto &queue = per_port[live[pick]];
+        g_schedule.push_back(std::move(queue.front()));
+        queue.pop_front();
+        if (queue.empty())
+        {
+            live[pick] = live.back();
+            live.pop_back();
+        }
+    }
+    const auto deliveries = g_schedule.size();
+
+    std::vector<SerialPort> ports;
+    ports.reserve(kPorts);
+    for (std::size_t port = 0; port < kPorts; ++port)
+    {
+        ports.emplace_back(SerialPort::Handle{kFirstHandle + static_cast<std::int64_t>(port)});
+    }
+    std::vector<PumpStats> stats(kPorts);
+    IoContext context;
+    for (std::size_t port = 0; port < kPorts; ++port)
+    {
+        context.spawn(pump(context, ports[port], port, stats[port]));
+    }
+    g_polls = 0;
+    const auto start = std::chrono::steady_clock::now();
+    const auto status = context.run();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::size_t frames = 0;
+    std::size_t mismatches = 0;
+    std::size_t reads = 0;
+    for (const auto &stat : stats)
+    {
+        frames += stat.frames;
+        mismatches += stat.mismatches;
+        reads += stat.reads;
+    }
+    check(status.has_value(), "run() succeeds", failures);
+    check(context.pending() == 0, "every pump finished", failures);
+    check(frames == kPorts * kFramesPerPort, "every frame decoded", failures);
+    check(mismatches == 0, "decoded payloads match", failures);
+    std::printf("async_port fan-in: %zu ports, %zu chunks, %zu frames, %zu reads, %zu polls in %.1f ms "
+                "(%.0f ns/read)\n",
+                kPorts, deliveries, frames, reads, g_polls, elapsed.count() * 1e3,
+                elapsed.count() * 1e9 / static_cast<double>(reads));
+}
+
+auto readUntilTask(AsyncPort &async, std::span<std::byte> line, Result<std::size_t> &out) -> Task<>
+{
+    out = co_await async.readUntil(line, "\r\n");
+}
+
+auto readableTask(IoContext &context, std::int64_t handle, Result<bool> &out) -> Task<>
+{
+    out = co_await context.readable(handle, TimeoutMs{5});
+}
+
+auto readTask(AsyncPort &async, std::span<std::byte> buffer, Result<std::size_t> &out) -> Task<>
+{
+    out = co_await async.read(buffer);
+}
+
+auto edgeCases(int &failures) -> void
+{
+    g_ports.assign(2, {});
+    g_schedule.clear();
+    g_schedule.push_back({0, bytesOf("hello\r")});
+    g_schedule.push_back({0, bytesOf("\nrest")});
+
+    SerialPort chatty{SerialPort::Handle{kFirstHandle}};
+    SerialPort silent{SerialPort::Handle{kFirstHandle + 1}};
+    IoContext context;
+    AsyncPort async{context, chatty};
+    std::array<std::byte, 32> line{};
+    Result<std::size_t> line_size{std::size_t{0}};
+    Result<bool> readable{true};
+    context.spawn(readUntilTask(async, line, line_size));
+    context.spawn(readableTask(context, silent.handle(), readable));
+    check(context.run().has_value(), "edge-case run() succeeds", failures);
+    check(line_size.has_value() && *line_size == 7
+              && std::memcmp(line.data(), "hello\r\n", 7) == 0,
+          "readUntil() stops after a split terminator", failures);
+    check(g_ports[0].rx.size() == 4, "bytes after the terminator stay queued", failures);
+    check(readable.has_value() && !*readable, "readable() times out on a silent port", failures);
+
+    AsyncPort silent_async{context, silent};
+    Result<std::size_t> cancelled{std::size_t{0}};
+    context.spawn(readTask(silent_async, line, cancelled));
+    std::thread canceller([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        static_cast<void>(silent_async.cancel());
+    });
+    check(context.run().has_value(), "cancelled run() succeeds", failures);
+    canceller.join();
+    check(!cancelled.has_value() && cancelled.error() == cpp_core::StatusCode::Io::kAbortReadError,
+          "cancel() fails the pending read with kAbortReadError", failures);
+}
+
+} // namespace
+
+auto main() -> int
+{
+    int failures = 0;
+    fanIn(failures);
+    edgeCases(failures);
+    std::printf("async_port: %d failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
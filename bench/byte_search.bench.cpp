@@ -0,0 +1,132 @@
+// Correctness and throughput check for the findByte() / findSequence() kernels. Every SearchLevel the
+// CPU supports is compared against the scalar kernel on randomized inputs, then timed on a 1 MiB buffer
+// with the match at the very end. Exits non-zero on any mismatch.
+
+#include "cpp_core/byte_search.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <vector>
+
+namespace
+{
+
+using cpp_core::SearchLevel;
+
+constexpr std::array kLevelNames{"scalar", "sse2", "avx2", "avx512"};
+
+struct Rng
+{
+    std::uint64_t state;
+
+    auto next() -> std::uint64_t
+    {
+        state ^= state << 13U;
+        state ^= state >> 7U;
+        state ^= state << 17U;
+        return state;
+    }
+
+    auto below(std::size_t bound) -> std::size_t
+    {
+        return static_cast<std::size_t>(next() % bound);
+    }
+};
+
+auto supportedLevels() -> std::vector<SearchLevel>
+{
+    std::vector<SearchLevel> levels;
+    for (int level = 0; level <= static_cast<int>(cpp_core::supportedSearchLevel()); ++level)
+    {
+        levels.push_back(static_cast<SearchLevel>(level));
+    }
+    return levels;
+}
+
+auto levelName(SearchLevel level) -> const char *
+{
+    return kLevelNames.at(static_cast<std::size_t>(level));
+}
+
+// Small alphabet so partial first/last-byte matches are frequent.
+auto verify(const std::vector<SearchLevel> &levels) -> std::size_t
+{
+    Rng rng{0x9E3779B97F4A7C15ULL};
+    std::size_t failures = 0;
+    std::vector<std::byte> data;
+    std::vector<std::byte> sequence;
+    for (int round = 0; round < 20'000; ++round)
+    {
+        data.resize(rng.below(300));
+        for (auto &value : data)
+        {
+            value = static_cast<std::byte>('a' + rng.below(4));
+        }
+        sequence.resize(1 + rng.below(6));
+        for (auto &value : sequence)
+        {
+            value = static_cast<std::byte>('a' + rng.below(4));
+        }
+
+        const auto needle = sequence.front();
+        const auto expected_byte = cpp_core::findByte(data, needle, SearchLevel::kScalar);
+        const auto expected_sequence = cpp_core::findSequence(data, sequence, SearchLevel::kScalar);
+        for (const auto level : levels)
+        {
+            if (cpp_core::findByte(data, needle, level) != expected_byte
+                || cpp_core::findSequence(data, sequence, level) != expected_sequence)
+            {
+                std::printf("mismatch: level=%s size=%zu sequence=%zu\n", levelName(level), data.size(),
+                            sequence.size());
+                ++failures;
+            }
+        }
+    }
+    return failures;
+}
+
+template <typename Fn> auto throughputMiBs(std::size_t bytes, Fn &&search) -> double
+{
+    constexpr int kRepeats = 200;
+    std::size_t sink = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kRepeats; ++i)
+    {
+        sink += search();
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    if (sink == 0)
+    {
+        std::printf("unexpected zero result\n");
+    }
+    return static_cast<double>(bytes) * kRepeats / (1024.0 * 1024.0) / elapsed.count();
+}
+
+} // namespace
+
+auto main() -> int
+{
+    const auto levels = supportedLevels();
+    const auto failures = verify(levels);
+
+    std::vector<std::byte> haystack(std::size_t{1} << 20, std::byte{'a'});
+    const std::array terminator{std::byte{'\r'}, std::byte{'\n'}};
+    haystack[haystack.size() - 2] = terminator[0];
+    haystack[haystack.size() - 1] = terminator[1];
+
+    for (const auto level : levels)
+    {
+        const auto byte_rate =
+            throughputMiBs(haystack.size(), [&] { return cpp_core::findByte(haystack, std::byte{'\n'}, level); });
+        const auto sequence_rate =
+            throughputMiBs(haystack.size(), [&] { return cpp_core::findSequence(haystack, terminator, level); });
+        std::printf("byte_search %-7s findByte %9.1f MiB/s  findSequence %9.1f MiB/s\n", levelName(level), byte_rate,
+                    sequence_rate);
+    }
+    std::printf("byte_search: %zu mismatches\n", failures);
+    return failures == 0 ? 0 : 1;
+}
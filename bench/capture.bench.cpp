@@ -0,0 +1,192 @@
+// Round trip of the capture file format: records written with capture::Recorder are read back with
+// capture::Reader and compared field by field, including a capture cut short mid-record. Also prints how
+// fast a Recorder takes data records and a Reader walks them.
+
+#include "cpp_core/capture.hpp"
+#include "cpp_core/serial_config.hpp"
+
+#include <unistd.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+
+using namespace cpp_core::capture;
+using namespace std::chrono_literals;
+
+constexpr std::size_t kThroughputBytes = std::size_t{64} << 20;
+constexpr std::size_t kThroughputChunk = 4096;
+constexpr auto kConfig = cpp_core::SerialConfig::make<57600, 7, cpp_core::Parity::kEven>();
+
+auto check(bool condition, const char *what, int &failures) -> void
+{
+    if (!condition)
+    {
+        std::printf("FAIL: %s\n", what);
+        ++failures;
+    }
+}
+
+auto bytesOf(std::string_view text) -> std::span<const std::byte>
+{
+    return std::as_bytes(std::span(text));
+}
+
+auto textOf(const Record &record) -> std::string_view
+{
+    return {reinterpret_cast<const char *>(record.payload.data()), record.payload.size()};
+}
+
+// Fresh empty file under /tmp; empty string if it could not be created.
+auto tempFile() -> std::string
+{
+    std::string path = "/tmp/cpp_core_captureXXXXXX";
+    const int fd = mkstemp(path.data());
+    if (fd < 0)
+    {
+        return {};
+    }
+    close(fd);
+    return path;
+}
+
+auto fileBytes(const std::string &path) -> std::vector<std::byte>
+{
+    std::vector<std::byte> bytes;
+    if (std::FILE *file = std::fopen(path.c_str(), "rb"))
+    {
+        std::array<std::byte, 64 * 1024> chunk{};
+        for (std::size_t got = 0; (got = std::fread(chunk.data(), 1, chunk.size(), file)) > 0;)
+        {
+            bytes.insert(bytes.end(), chunk.begin(), chunk.begin() + static_cast<std::ptrdiff_t>(got));
+        }
+        std::fclose(file);
+    }
+    return bytes;
+}
+
+auto checkRoundTrip(const std::string &path, int &failures) -> void
+{
+    auto recorder = Recorder::tryOpen(path.c_str());
+    check(recorder.has_value(), "recorder opens", failures);
+    if (!recorder)
+    {
+        return;
+    }
+    const auto start = Clock::now();
+    (*recorder)->config(kConfig, start);
+    (*recorder)->lines(lineMask(true, true, true, false, true, false), start);
+    (*recorder)->data(Direction::kRx, bytesOf("hello\n"), start + 1ms);
+    (*recorder)->data(Direction::kTx, {}, start + 1ms);
+    (*recorder)->lineBreak(Direction::kTx, 250, start + 2ms);
+    (*recorder)->data(Direction::kTx, bytesOf("ack"), start + 3ms);
+    check((*recorder)->close().has_value(), "recorder closes cleanly", failures);
+    (*recorder)->data(Direction::kRx, bytesOf("late"), start + 4ms);
+
+    const auto file = fileBytes(path);
+    auto reader = Reader::tryMake(file);
+    check(reader.has_value() && reader->header().version == kVersion && reader->header().wall_start_ns > 0,
+          "reader accepts the file header", failures);
+    if (!reader)
+    {
+        return;
+    }
+    std::vector<Record> records;
+    while (const auto record = reader->next())
+    {
+        records.push_back(*record);
+    }
+    check(records.size() == 5, "every record but the empty and the late one is read back", failures);
+    if (records.size() != 5)
+    {
+        return;
+    }
+    const auto config = records[0].config();
+    check(records[0].kind == RecordKind::kConfig && config.has_value() && *config == kConfig,
+          "config record round-trips", failures);
+    check(records[1].kind == RecordKind::kLines && records[1].lines() == lineMask(true, true, true, false, true, false),
+          "lines record round-trips", failures);
+    check(records[2].kind == RecordKind::kData && records[2].direction == Direction::kRx &&
+              textOf(records[2]) == "hello\n",
+          "received data round-trips", failures);
+    check(records[3].kind == RecordKind::kBreak && records[3].direction == Direction::kTx &&
+              records[3].breakMs() == 250,
+          "break record round-trips", failures);
+    check(records[4].kind == RecordKind::kData && records[4].direction == Direction::kTx && textOf(records[4]) == "ack",
+          "sent data round-trips", failures);
+    check(records[1].timestamp_ns == records[0].timestamp_ns &&
+              records[2].timestamp_ns - records[0].timestamp_ns == 1'000'000 &&
+              records[4].timestamp_ns - records[0].timestamp_ns == 3'000'000,
+          "timestamps keep their spacing", failures);
+
+    auto cut = Reader::tryMake(std::span(file).first(file.size() - 1));
+    int complete = 0;
+    while (cut && cut->next())
+    {
+        ++complete;
+    }
+    check(complete == 4, "a capture cut mid-record reads up to its last complete record", failures);
+    check(!Reader::tryMake(std::span(file).first(sizeof(FileHeader) - 1)).has_value() &&
+              !Reader::tryMake(std::span(file).subspan(1)).has_value(),
+          "a short or shifted file is not a capture", failures);
+}
+
+auto measureThroughput(const std::string &path, int &failures) -> void
+{
+    auto recorder = Recorder::tryOpen(path.c_str());
+    if (!recorder)
+    {
+        check(false, "throughput recorder opens", failures);
+        return;
+    }
+    const std::vector<std::byte> chunk(kThroughputChunk, std::byte{0x5A});
+    const auto write_start = Clock::now();
+    for (std::size_t written = 0; written < kThroughputBytes; written += chunk.size())
+    {
+        (*recorder)->data(Direction::kRx, chunk);
+    }
+    check((*recorder)->close().has_value(), "throughput capture closes", failures);
+    const std::chrono::duration<double> write_s = Clock::now() - write_start;
+
+    const auto file = fileBytes(path);
+    const auto read_start = Clock::now();
+    std::size_t read = 0;
+    if (auto reader = Reader::tryMake(file))
+    {
+        while (const auto record = reader->next())
+        {
+            read += record->payload.size();
+        }
+    }
+    const std::chrono::duration<double> read_s = Clock::now() - read_start;
+    check(read == kThroughputBytes, "every captured byte is read back", failures);
+    const auto mib = static_cast<double>(kThroughputBytes) / (1024.0 * 1024.0);
+    std::printf("capture: record %.0f MiB/s, read %.0f MiB/s (4 KiB data records)\n", mib / write_s.count(),
+                mib / read_s.count());
+}
+
+} // namespace
+
+auto main() -> int
+{
+    int failures = 0;
+    const auto path = tempFile();
+    check(!path.empty(), "capture file created", failures);
+    if (!path.empty())
+    {
+        checkRoundTrip(path, failures);
+        measureThroughput(path, failures);
+        std::remove(path.c_str());
+    }
+    std::printf("capture: %d failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
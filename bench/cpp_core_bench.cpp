@@ -0,0 +1,696 @@
+// ABI harness for any serial.h binding: dlopen()s the shared library, opens a port (and optionally its peer,
+// e.g. the two ends of a pty pair or a loop://NAME/0 + /1 loopback pair) and runs a parameter matrix over
+// baud rate, buffer size and timeout_ms/multiplier for three scenarios:
+//   read        - serialRead() on the receiving end while a writer thread streams the payload
+//   read_line   - the same with newline-terminated records and serialReadLine()
+//   write_drain - serialWrite() + serialDrain() per buffer while a reader thread empties the peer
+// Every case verifies the received bytes and reports throughput, p50/p99/p999 call latency and read()/write()
+// syscalls per byte (from /proc/self/io) as one JSON document. Exits 1 if any case lost or corrupted data,
+// 2 on usage or loading errors.
+//
+//   cpp_core_bench --library libcpp_bindings_linux.so --port /dev/pts/3 --peer /dev/pts/4 --output out.json
+
+#include "cpp_core/serial.h"
+
+#include <dlfcn.h>
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+// A call that makes no progress for this long (on top of the payload's wire time) fails the case.
+constexpr auto kStallLimit = std::chrono::seconds(2);
+constexpr int kWriterChunk = 4096;
+constexpr int kWriterTimeoutMs = 1000;
+constexpr int kDrainReadTimeoutMs = 10;
+// Case error for "no progress within kStallLimit"; every binding status is a small negative number.
+constexpr int kStalled = std::numeric_limits<int>::min();
+
+struct Binding
+{
+    void *library = nullptr;
+    decltype(&::serialOpen) open = nullptr;
+    decltype(&::serialClose) close = nullptr;
+    decltype(&::serialRead) read = nullptr;
+    decltype(&::serialReadLine) read_line = nullptr;
+    decltype(&::serialWrite) write = nullptr;
+    decltype(&::serialDrain) drain = nullptr;
+    decltype(&::serialClearBufferIn) clear_in = nullptr;
+    decltype(&::serialStatusName) status_name = nullptr; // optional: older bindings lack it
+};
+
+template <typename Fn> auto resolve(void *library, const char *name, Fn &out) -> bool
+{
+    out = reinterpret_cast<Fn>(::dlsym(library, name));
+    if (out == nullptr)
+    {
+        std::fprintf(stderr, "cpp_core_bench: the binding does not export %s\n", name);
+        return false;
+    }
+    return true;
+}
+
+auto loadBinding(const char *path) -> std::optional<Binding>
+{
+    Binding binding{};
+    binding.library = ::dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if (binding.library == nullptr)
+    {
+        std::fprintf(stderr, "cpp_core_bench: %s\n", ::dlerror());
+        return std::nullopt;
+    }
+    const bool complete =
+        resolve(binding.library, "serialOpen", binding.open) && resolve(binding.library, "serialClose", binding.close)
+        && resolve(binding.library, "serialRead", binding.read)
+        && resolve(binding.library, "serialReadLine", binding.read_line)
+        && resolve(binding.library, "serialWrite", binding.write)
+        && resolve(binding.library, "serialDrain", binding.drain)
+        && resolve(binding.library, "serialClearBufferIn", binding.clear_in);
+    if (!complete)
+    {
+        ::dlclose(binding.library);
+        return std::nullopt;
+    }
+    binding.status_name = reinterpret_cast<decltype(binding.status_name)>(::dlsym(binding.library, "serialStatusName"));
+    return binding;
+}
+
+enum class Scenario
+{
+    kRead,
+    kReadLine,
+    kWriteDrain,
+};
+
+auto scenarioName(Scenario scenario) -> const char *
+{
+    switch (scenario)
+    {
+    case Scenario::kRead:
+        return "read";
+    case Scenario::kReadLine:
+        return "read_line";
+    case Scenario::kWriteDrain:
+        return "write_drain";
+    }
+    return "unknown";
+}
+
+struct Timing
+{
+    int timeout_ms;
+    int multiplier;
+};
+
+struct Options
+{
+    std::string library;
+    std::string port = "loop://cpp_core_bench/0";
+    std::string peer = "loop://cpp_core_bench/1";
+    std::string output;
+    std::vector<int> baudrates{9600, 115200, 1000000};
+    std::vector<int> buffer_sizes{1, 64, 1024};
+    std::vector<Timing> timings{{10, 0}, {10, 1}, {100, 1}};
+    std::vector<Scenario> scenarios{Scenario::kRead, Scenario::kReadLine, Scenario::kWriteDrain};
+    double seconds = 1.0;
+};
+
+struct Case
+{
+    Scenario scenario;
+    int baudrate;
+    int buffer_size;
+    Timing timing;
+};
+
+struct Measurement
+{
+    std::int64_t bytes = 0;
+    double seconds = 0.0;
+    std::vector<std::int64_t> latencies_ns;
+    std::optional<std::int64_t> syscalls;
+    int error = 0;
+    bool corrupted = false;
+};
+
+struct IoCounters
+{
+    std::int64_t syscr = 0;
+    std::int64_t syscw = 0;
+};
+
+// read()/write() syscall counts of the whole process; absent where /proc/self/io is not available.
+auto readIoCounters() -> std::optional<IoCounters>
+{
+    std::ifstream io("/proc/self/io");
+    if (!io)
+    {
+        return std::nullopt;
+    }
+    IoCounters counters{};
+    std::string key;
+    std::int64_t value = 0;
+    while (io >> key >> value)
+    {
+        if (key == "syscr:")
+        {
+            counters.syscr = value;
+        }
+        else if (key == "syscw:")
+        {
+            counters.syscw = value;
+        }
+    }
+    return counters;
+}
+
+// Reading /proc/self/io costs read() calls of its own; measured once so results can exclude it.
+auto probeSyscalls() -> std::int64_t
+{
+    const auto first = readIoCounters();
+    const auto second = readIoCounters();
+    if (!first || !second)
+    {
+        return 0;
+    }
+    return (second->syscr - first->syscr) + (second->syscw - first->syscw);
+}
+
+auto parseInt(std::string_view text) -> std::optional<int>
+{
+    int value = 0;
+    const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (error != std::errc{} || end != text.data() + text.size())
+    {
+        return std::nullopt;
+    }
+    return value;
+}
+
+// Splits "a,b,c" and parses each item; nullopt if any item is malformed.
+template <typename T, typename Parse>
+auto parseList(std::string_view text, Parse parse) -> std::optional<std::vector<T>>
+{
+    std::vector<T> items;
+    while (!text.empty())
+    {
+        const auto comma = text.find(',');
+        const auto item = parse(text.substr(0, comma));
+        if (!item)
+        {
+            return std::nullopt;
+        }
+        items.push_back(*item);
+        text = comma == std::string_view::npos ? std::string_view{} : text.substr(comma + 1);
+    }
+    return items.empty() ? std::nullopt : std::optional(std::move(items));
+}
+
+auto parseTiming(std::string_view text) -> std::optional<Timing>
+{
+    const auto colon = text.find(':');
+    if (colon == std::string_view::npos)
+    {
+        return std::nullopt;
+    }
+    const auto timeout_ms = parseInt(text.substr(0, colon));
+    const auto multiplier = parseInt(text.substr(colon + 1));
+    if (!timeout_ms || !multiplier)
+    {
+        return std::nullopt;
+    }
+    return Timing{*timeout_ms, *multiplier};
+}
+
+auto parseScenario(std::string_view text) -> std::optional<Scenario>
+{
+    for (const auto scenario : {Scenario::kRead, Scenario::kReadLine, Scenario::kWriteDrain})
+    {
+        if (text == scenarioName(scenario))
+        {
+            return scenario;
+        }
+    }
+    return std::nullopt;
+}
+
+auto usage() -> void
+{
+    std::fprintf(stderr,
+                 "usage: cpp_core_bench --library PATH [--port PATH] [--peer PATH|none] [--output FILE]\n"
+                 "                      [--baud LIST] [--buffer LIST] [--timing MS:MULT,...]\n"
+                 "                      [--scenario read,read_line,write_drain] [--seconds S] [--quick]\n"
+                 "Without a peer the port must echo its own writes (loop://NAME, a loopback plug).\n");
+}
+
+auto parseOptions(std::span<char *> args) -> std::optional<Options>
+{
+    Options options{};
+    for (std::size_t i = 0; i < args.size(); ++i)
+    {
+        const std::string_view flag = args[i];
+        if (flag == "--quick")
+        {
+            options.baudrates = {115200, 1000000};
+            options.buffer_sizes = {64, 1024};
+            options.timings = {{10, 1}};
+            options.seconds = 0.05;
+            continue;
+        }
+        if (i + 1 == args.size())
+        {
+            return std::nullopt;
+        }
+        const std::string_view value = args[++i];
+        bool parsed = true;
+        if (flag == "--library")
+        {
+            options.library = value;
+        }
+        else if (flag == "--port")
+        {
+            options.port = value;
+        }
+        else if (flag == "--peer")
+        {
+            options.peer = value == "none" ? std::string{} : std::string{value};
+        }
+        else if (flag == "--output")
+        {
+            options.output = value;
+        }
+        else if (flag == "--baud")
+        {
+            auto list = parseList<int>(value, parseInt);
+            parsed = list.has_value();
+            options.baudrates = list.value_or(options.baudrates);
+        }
+        else if (flag == "--buffer")
+        {
+            auto list = parseList<int>(value, parseInt);
+            parsed = list.has_value() && std::ranges::all_of(*list, [](int size) { return size > 0; });
+            options.buffer_sizes = list.value_or(options.buffer_sizes);
+        }
+        else if (flag == "--timing")
+        {
+            auto list = parseList<Timing>(value, parseTiming);
+            parsed = list.has_value();
+            options.timings = list.value_or(options.timings);
+        }
+        else if (flag == "--scenario")
+        {
+            auto list = parseList<Scenario>(value, parseScenario);
+            parsed = list.has_value();
+            options.scenarios = list.value_or(options.scenarios);
+        }
+        else if (flag == "--seconds")
+        {
+            options.seconds = std::strtod(std::string{value}.c_str(), nullptr);
+            parsed = options.seconds > 0.0;
+        }
+        else
+        {
+            parsed = false;
+        }
+        if (!parsed)
+        {
+            return std::nullopt;
+        }
+    }
+    if (options.library.empty())
+    {
+        return std::nullopt;
+    }
+    return options;
+}
+
+// Whole buffers worth roughly `seconds` of wire time at 10 bits per byte; read_line records end in '\n'.
+auto makePayload(const Case &bench_case, double seconds) -> std::vector<std::byte>
+{
+    const auto wire_bytes = static_cast<std::int64_t>(bench_case.baudrate / 10.0 * seconds);
+    const auto buffers = std::max<std::int64_t>(1, (wire_bytes + bench_case.buffer_size - 1) / bench_case.buffer_size);
+    std::vector<std::byte> payload(static_cast<std::size_t>(buffers * bench_case.buffer_size));
+    for (std::size_t i = 0; i < payload.size(); ++i)
+    {
+        payload[i] = static_cast<std::byte>('!' + i % 64);
+        const auto record_end = (i + 1) % static_cast<std::size_t>(bench_case.buffer_size) == 0;
+        if (bench_case.scenario == Scenario::kReadLine && record_end)
+        {
+            payload[i] = std::byte{'\n'};
+        }
+    }
+    return payload;
+}
+
+auto nsSince(Clock::time_point start) -> std::int64_t
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+}
+
+struct Ports
+{
+    std::int64_t sender;
+    std::int64_t receiver;
+};
+
+// Runs @p send on its own thread and @p receive on this one; a failing side raises @p stop so the other gives
+// up too. Returns the failing side's status, or 0.
+template <typename Send, typename Receive>
+auto transfer(std::atomic<bool> &stop, Send &&send, Receive &&receive) -> int
+{
+    std::atomic<int> send_error{0};
+    std::jthread sender([&] {
+        send_error = send();
+        if (send_error != 0)
+        {
+            stop = true;
+        }
+    });
+    const int receive_error = receive();
+    if (receive_error != 0)
+    {
+        stop = true;
+    }
+    sender.join();
+    return receive_error != 0 ? receive_error : send_error.load();
+}
+
+auto writeAll(const Binding &binding, std::int64_t handle, std::span<const std::byte> payload,
+              std::atomic<bool> &stop) -> int
+{
+    std::size_t sent = 0;
+    while (sent < payload.size() && !stop)
+    {
+        const auto chunk = std::min<std::size_t>(kWriterChunk, payload.size() - sent);
+        const int written =
+            binding.write(handle, payload.data() + sent, static_cast<int>(chunk), kWriterTimeoutMs, 1, nullptr);
+        if (written < 0)
+        {
+            return written;
+        }
+        sent += static_cast<std::size_t>(written);
+    }
+    return 0;
+}
+
+auto runCase(const Binding &binding, const Ports &ports, const Case &bench_case, double seconds,
+             std::int64_t probe_syscalls) -> Measurement
+{
+    const auto payload = makePayload(bench_case, seconds);
+    const auto stall_limit = kStallLimit + std::chrono::duration<double>(seconds * 2.0);
+    std::vector<std::byte> received(payload.size());
+    Measurement measurement{};
+    measurement.latencies_ns.reserve(payload.size() / static_cast<std::size_t>(bench_case.buffer_size) + 16);
+    std::atomic<bool> stop{false};
+
+    // Reads on @p handle until the payload is complete, timing each call of @p read.
+    const auto receiveAll = [&](std::int64_t handle, auto read, bool timed) -> int {
+        std::size_t filled = 0;
+        auto last_progress = Clock::now();
+        while (filled < received.size() && !stop)
+        {
+            const auto room = std::min<std::size_t>(static_cast<std::size_t>(bench_case.buffer_size),
+                                                    received.size() - filled);
+            const auto start = Clock::now();
+            const int got = read(handle, received.data() + filled, static_cast<int>(room));
+            if (timed)
+            {
+                measurement.latencies_ns.push_back(nsSince(start));
+            }
+            if (got < 0)
+            {
+                return got;
+            }
+            if (got > 0)
+            {
+                filled += static_cast<std::size_t>(got);
+                last_progress = Clock::now();
+            }
+            else if (Clock::now() - last_progress > stall_limit)
+            {
+                return kStalled;
+            }
+        }
+        return 0;
+    };
+
+    const auto before = readIoCounters();
+    const auto start = Clock::now();
+    switch (bench_case.scenario)
+    {
+    case Scenario::kRead:
+        measurement.error = transfer(stop, [&] { return writeAll(binding, ports.sender, payload, stop); },
+                                     [&] {
+                                         return receiveAll(
+                                             ports.receiver,
+                                             [&](std::int64_t handle, std::byte *out, int size) {
+                                                 return binding.read(handle, out, size, bench_case.timing.timeout_ms,
+                                                                     bench_case.timing.multiplier, nullptr);
+                                             },
+                                             true);
+                                     });
+        break;
+    case Scenario::kReadLine:
+        measurement.error = transfer(stop, [&] { return writeAll(binding, ports.sender, payload, stop); },
+                                     [&] {
+                                         return receiveAll(
+                                             ports.receiver,
+                                             [&](std::int64_t handle, std::byte *out, int size) {
+                                                 return binding.read_line(handle, out, size,
+                                                                          bench_case.timing.timeout_ms,
+                                                                          bench_case.timing.multiplier, nullptr);
+                                             },
+                                             true);
+                                     });
+        break;
+    case Scenario::kWriteDrain:
+        measurement.error = transfer(
+            stop, [&] {
+                const auto buffer = static_cast<std::size_t>(bench_case.buffer_size);
+                for (std::size_t sent = 0; sent < payload.size() && !stop; sent += buffer)
+                {
+                    const auto call_start = Clock::now();
+                    const int written = binding.write(ports.sender, payload.data() + sent, bench_case.buffer_size,
+                                                      bench_case.timing.timeout_ms, bench_case.timing.multiplier,
+                                                      nullptr);
+                    const int drained = written < 0 ? written : binding.drain(ports.sender, nullptr);
+                    measurement.latencies_ns.push_back(nsSince(call_start));
+                    if (drained < 0)
+                    {
+                        return drained;
+                    }
+                    if (written != bench_case.buffer_size)
+                    {
+                        return kStalled;
+                    }
+                }
+                return 0;
+            },
+            [&] {
+                return receiveAll(
+                    ports.receiver,
+                    [&](std::int64_t handle, std::byte *out, int size) {
+                        return binding.read(handle, out, size, kDrainReadTimeoutMs, 0, nullptr);
+                    },
+                    false);
+            });
+        break;
+    }
+    measurement.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    const auto after = readIoCounters();
+    if (before && after)
+    {
+        measurement.syscalls =
+            std::max<std::int64_t>(0, (after->syscr - before->syscr) + (after->syscw - before->syscw) - probe_syscalls);
+    }
+    measurement.bytes = static_cast<std::int64_t>(payload.size());
+    measurement.corrupted = measurement.error == 0 && !std::ranges::equal(payload, received);
+    return measurement;
+}
+
+auto percentile(std::span<const std::int64_t> sorted, double quantile) -> std::int64_t
+{
+    if (sorted.empty())
+    {
+        return 0;
+    }
+    const auto rank = static_cast<std::size_t>(quantile * static_cast<double>(sorted.size()));
+    const auto index = std::min(sorted.size() - 1, rank);
+    return sorted[index];
+}
+
+auto statusText(const Binding &binding, int code) -> std::string
+{
+    if (code == kStalled)
+    {
+        return "stalled";
+    }
+    if (binding.status_name == nullptr)
+    {
+        return std::to_string(code);
+    }
+    return binding.status_name(code);
+}
+
+auto writeJsonString(std::FILE *out, std::string_view text) -> void
+{
+    std::fputc('"', out);
+    for (const char c : text)
+    {
+        if (c == '"' || c == '\\')
+        {
+            std::fputc('\\', out);
+        }
+        if (static_cast<unsigned char>(c) < 0x20)
+        {
+            std::fprintf(out, "\\u%04x", static_cast<unsigned>(c));
+            continue;
+        }
+        std::fputc(c, out);
+    }
+    std::fputc('"', out);
+}
+
+auto writeResult(std::FILE *out, const Binding &binding, const Case &bench_case, Measurement &measurement) -> void
+{
+    std::ranges::sort(measurement.latencies_ns);
+    const auto &latencies = measurement.latencies_ns;
+    const double bytes = static_cast<double>(measurement.bytes);
+    std::fprintf(out,
+                 "    {\"scenario\": \"%s\", \"baudrate\": %d, \"buffer_size\": %d, \"timeout_ms\": %d, "
+                 "\"multiplier\": %d,\n"
+                 "     \"bytes\": %lld, \"calls\": %zu, \"seconds\": %.6f, \"throughput_bytes_per_s\": %.1f,\n"
+                 "     \"latency_ns\": {\"p50\": %lld, \"p99\": %lld, \"p999\": %lld, \"max\": %lld},\n",
+                 scenarioName(bench_case.scenario), bench_case.baudrate, bench_case.buffer_size,
+                 bench_case.timing.timeout_ms, bench_case.timing.multiplier,
+                 static_cast<long long>(measurement.bytes), latencies.size(), measurement.seconds,
+                 measurement.seconds > 0.0 ? bytes / measurement.seconds : 0.0,
+                 static_cast<long long>(percentile(latencies, 0.50)),
+                 static_cast<long long>(percentile(latencies, 0.99)),
+                 static_cast<long long>(percentile(latencies, 0.999)),
+                 static_cast<long long>(latencies.empty() ? 0 : latencies.back()));
+    if (measurement.syscalls)
+    {
+        std::fprintf(out, "     \"syscalls_per_byte\": %.6f, ", static_cast<double>(*measurement.syscalls) / bytes);
+    }
+    else
+    {
+        std::fprintf(out, "     \"syscalls_per_byte\": null, ");
+    }
+    std::fprintf(out, "\"ok\": %s, \"error\": ", measurement.error == 0 && !measurement.corrupted ? "true" : "false");
+    if (measurement.error != 0)
+    {
+        writeJsonString(out, statusText(binding, measurement.error));
+    }
+    else
+    {
+        std::fprintf(out, measurement.corrupted ? "\"corrupted\"" : "null");
+    }
+    std::fprintf(out, "}");
+}
+
+auto openPort(const Binding &binding, const std::string &path, int baudrate) -> std::int64_t
+{
+    return binding.open(const_cast<char *>(path.c_str()), baudrate, 8, 0, 0, nullptr);
+}
+
+} // namespace
+
+auto main(int argc, char **argv) -> int
+{
+    const auto options = parseOptions(std::span(argv, static_cast<std::size_t>(argc)).subspan(1));
+    if (!options)
+    {
+        usage();
+        return 2;
+    }
+    const auto binding = loadBinding(options->library.c_str());
+    if (!binding)
+    {
+        return 2;
+    }
+    std::FILE *out = options->output.empty() ? stdout : std::fopen(options->output.c_str(), "w");
+    if (out == nullptr)
+    {
+        std::fprintf(stderr, "cpp_core_bench: cannot write %s\n", options->output.c_str());
+        return 2;
+    }
+
+    std::fprintf(out, "{\n  \"library\": ");
+    writeJsonString(out, options->library);
+    std::fprintf(out, ",\n  \"port\": ");
+    writeJsonString(out, options->port);
+    std::fprintf(out, ",\n  \"peer\": ");
+    writeJsonString(out, options->peer);
+    std::fprintf(out, ",\n  \"results\": [\n");
+
+    const auto probe_syscalls = probeSyscalls();
+    int failures = 0;
+    bool first = true;
+    for (const auto baudrate : options->baudrates)
+    {
+        const auto sender = openPort(*binding, options->port, baudrate);
+        const auto receiver = options->peer.empty() ? sender : openPort(*binding, options->peer, baudrate);
+        if (sender <= 0 || receiver <= 0)
+        {
+            std::fprintf(stderr, "cpp_core_bench: cannot open %s at %d baud: %s\n", options->port.c_str(), baudrate,
+                         statusText(*binding, static_cast<int>(std::min(sender, receiver))).c_str());
+            failures += 1;
+            (void)binding->close(sender, nullptr);
+            continue;
+        }
+        const Ports ports{sender, receiver};
+        for (const auto scenario : options->scenarios)
+        {
+            for (const auto buffer_size : options->buffer_sizes)
+            {
+                for (const auto timing : options->timings)
+                {
+                    const Case bench_case{scenario, baudrate, buffer_size, timing};
+                    (void)binding->clear_in(receiver, nullptr);
+                    auto measurement = runCase(*binding, ports, bench_case, options->seconds, probe_syscalls);
+                    if (measurement.error != 0 || measurement.corrupted)
+                    {
+                        ++failures;
+                        std::fprintf(stderr, "FAIL: %s baud=%d buffer=%d timing=%d:%d\n", scenarioName(scenario),
+                                     baudrate, buffer_size, timing.timeout_ms, timing.multiplier);
+                    }
+                    std::fprintf(out, first ? "" : ",\n");
+                    first = false;
+                    writeResult(out, *binding, bench_case, measurement);
+                    std::fflush(out);
+                }
+            }
+        }
+        if (receiver != sender)
+        {
+            (void)binding->close(receiver, nullptr);
+        }
+        (void)binding->close(sender, nullptr);
+    }
+    std::fprintf(out, "\n  ],\n  \"failures\": %d\n}\n", failures);
+    if (out != stdout)
+    {
+        std::fclose(out);
+    }
+    std::fprintf(stderr, "cpp_core_bench: %d failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
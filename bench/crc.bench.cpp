@@ -0,0 +1,116 @@
+// Correctness and throughput check for the Crc<> engine. The slicing-by-8 and PCLMULQDQ kernels are
+// compared against the bit-at-a-time reference on randomized inputs and split points, then timed on a
+// 1 MiB buffer. Exits non-zero on any mismatch.
+
+#include "cpp_core/crc.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <vector>
+
+namespace
+{
+
+using cpp_core::CrcKernel;
+
+struct Rng
+{
+    std::uint64_t state;
+
+    auto next() -> std::uint64_t
+    {
+        state ^= state << 13U;
+        state ^= state >> 7U;
+        state ^= state << 17U;
+        return state;
+    }
+
+    auto below(std::size_t bound) -> std::size_t
+    {
+        return static_cast<std::size_t>(next() % bound);
+    }
+};
+
+auto kernelName(CrcKernel kernel) -> const char *
+{
+    return kernel == CrcKernel::kClmul ? "clmul" : "slicing8";
+}
+
+template <typename Engine> auto verify(CrcKernel kernel) -> std::size_t
+{
+    constexpr auto kSpec = cpp_core::kCrc32;
+    Rng rng{0x9E3779B97F4A7C15ULL};
+    std::size_t failures = 0;
+    std::vector<std::byte> data;
+    for (int round = 0; round < 5'000; ++round)
+    {
+        data.resize(rng.below(2'000));
+        for (auto &value : data)
+        {
+            value = static_cast<std::byte>(rng.next());
+        }
+        const auto expected = cpp_core::detail::crc::bitwise(kSpec, data);
+        const auto split = data.empty() ? 0 : rng.below(data.size());
+        Engine streamed;
+        streamed.update(std::span(data).first(split)).update(std::span(data).subspan(split));
+        if (Engine::compute(data, kernel) != expected || streamed.value() != expected)
+        {
+            std::printf("mismatch: kernel=%s size=%zu split=%zu\n", kernelName(kernel), data.size(), split);
+            ++failures;
+        }
+    }
+    return failures;
+}
+
+template <typename Fn> auto throughputMiBs(std::size_t bytes, Fn &&checksum) -> double
+{
+    constexpr int kRepeats = 200;
+    std::uint64_t sink = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kRepeats; ++i)
+    {
+        sink ^= checksum();
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    if (sink == 1)
+    {
+        std::printf("unlikely checksum\n");
+    }
+    return static_cast<double>(bytes) * kRepeats / (1024.0 * 1024.0) / elapsed.count();
+}
+
+} // namespace
+
+auto main() -> int
+{
+    std::vector<CrcKernel> kernels{CrcKernel::kSlicingBy8};
+    if (cpp_core::supportedCrcKernel() == CrcKernel::kClmul)
+    {
+        kernels.push_back(CrcKernel::kClmul);
+    }
+
+    std::size_t failures = 0;
+    for (const auto kernel : kernels)
+    {
+        failures += verify<cpp_core::Crc32>(kernel);
+    }
+
+    std::vector<std::byte> buffer(std::size_t{1} << 20);
+    Rng rng{42};
+    for (auto &value : buffer)
+    {
+        value = static_cast<std::byte>(rng.next());
+    }
+    for (const auto kernel : kernels)
+    {
+        const auto rate = throughputMiBs(buffer.size(), [&] { return cpp_core::Crc32::compute(buffer, kernel); });
+        std::printf("crc CRC-32        %-8s %9.1f MiB/s\n", kernelName(kernel), rate);
+    }
+    const auto modbus = throughputMiBs(buffer.size(), [&] { return cpp_core::Crc16Modbus::compute(buffer); });
+    std::printf("crc CRC-16/MODBUS %-8s %9.1f MiB/s\n", "slicing8", modbus);
+    std::printf("crc: %zu mismatches\n", failures);
+    return failures == 0 ? 0 : 1;
+}
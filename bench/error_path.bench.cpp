@@ -0,0 +1,127 @@
+// Heap-allocation and latency check for the error path that timeouts and aborts hit on every call:
+// fail() with and without a message, Result propagation, toCResult(), invokeError() and the lazily
+// formatted failMsg(prefix, detail). Global operator new is counted; any allocation exits non-zero.
+
+#include "cpp_core/error_handling.hpp"
+#include "cpp_core/result.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string_view>
+
+namespace
+{
+
+std::atomic<std::size_t> g_allocations{0};
+
+} // namespace
+
+auto operator new(std::size_t size) -> void *
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *memory = std::malloc(size == 0 ? 1 : size))
+    {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+auto operator delete(void *memory) noexcept -> void
+{
+    std::free(memory);
+}
+
+auto operator delete(void *memory, std::size_t) noexcept -> void
+{
+    std::free(memory);
+}
+
+namespace
+{
+
+using cpp_core::Result;
+using cpp_core::StatusCode;
+
+constexpr int kIterations = 1'000'000;
+
+std::atomic<int> g_callback_calls{0};
+
+auto countingCallback(int, const char *message) -> void
+{
+    if (message != nullptr && message[0] != '\0')
+    {
+        g_callback_calls.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+[[gnu::noinline]] auto readTimeout(int attempt) -> Result<int>
+{
+    if (attempt >= 0)
+    {
+        return cpp_core::fail<int>(StatusCode::Io::kReadError, "Read timed out");
+    }
+    return attempt;
+}
+
+[[gnu::noinline]] auto readThroughLayers(int attempt) -> Result<int>
+{
+    auto read = readTimeout(attempt);
+    if (!read)
+    {
+        return cpp_core::forwardUnexpected(std::move(read));
+    }
+    return *read + 1;
+}
+
+[[gnu::noinline]] auto runtimeText(int attempt) -> Result<int>
+{
+    const std::string_view port = (attempt & 1) != 0 ? "/dev/ttyUSB0" : "/dev/ttyACM1";
+    return cpp_core::fail<int>(StatusCode::Connection::kNotFoundError, cpp_core::ErrorMessage{port});
+}
+
+struct Case
+{
+    const char *name;
+    int (*run)(int);
+};
+
+constexpr Case kCases[] = {
+    {"fail+propagate", [](int i) { return static_cast<int>(readThroughLayers(i).error().code); }},
+    {"fail runtime text", [](int i) { return static_cast<int>(runtimeText(i).error().code); }},
+    {"toCResult callback", [](int i) { return cpp_core::toCResult(readThroughLayers(i), &countingCallback); }},
+    {"failMsg literal", [](int) { return cpp_core::failMsg<int>(&countingCallback, -3, "Abort read"); }},
+    {"failMsg no callback",
+     [](int) { return cpp_core::failMsg<int>(nullptr, -3, "Open failed", std::string_view{"/dev/ttyUSB0"}); }},
+    {"failMsg prefix+detail",
+     [](int) {
+         return cpp_core::failMsg<int>(&countingCallback, -3, "Open failed", std::string_view{"/dev/ttyUSB0"});
+     }},
+};
+
+} // namespace
+
+auto main() -> int
+{
+    std::size_t total_allocations = 0;
+    for (const auto &test : kCases)
+    {
+        const auto before = g_allocations.load(std::memory_order_relaxed);
+        long long sink = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < kIterations; ++i)
+        {
+            sink += test.run(i);
+        }
+        const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        const auto allocations = g_allocations.load(std::memory_order_relaxed) - before;
+        total_allocations += allocations;
+        std::printf("error_path %-22s %6.1f ns/op  %zu allocations  (sink %lld)\n", test.name,
+                    elapsed.count() / kIterations, allocations, sink);
+    }
+    std::printf("error_path: %zu heap allocations, %d callback calls\n", total_allocations, g_callback_calls.load());
+    return total_allocations == 0 ? 0 : 1;
+}
@@ -0,0 +1,190 @@
+// Behaviour check of HandlePool on fake handles and a fake clock: LRU order, the max_idle cap,
+// idle_timeout expiry, park() when the flush fails or pooling is off, evict(), clear(), and that evicted handles
+// are closed after the pool lock is released. Also prints the cost of a park + acquire round.
+
+#include "cpp_core/handle_pool.hpp"
+#include "cpp_core/serial_config.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <future>
+#include <vector>
+
+namespace
+{
+
+using namespace std::chrono_literals;
+
+struct FakeClock
+{
+    using duration = std::chrono::steady_clock::duration;
+    using time_point = std::chrono::steady_clock::time_point;
+
+    static inline time_point current{};
+
+    static auto now() noexcept -> time_point
+    {
+        return current;
+    }
+};
+
+struct FakeTraits
+{
+    using handle_type = int;
+
+    static constexpr auto invalid() noexcept -> handle_type
+    {
+        return -1;
+    }
+
+    static auto close(handle_type handle) noexcept -> void;
+};
+
+using Pool = cpp_core::HandlePool<FakeTraits, FakeClock>;
+using Resource = Pool::Resource;
+
+Pool *g_pool = nullptr;
+std::vector<int> g_closed;
+
+// Closing while the pool lock is held would deadlock this probe, which takes the lock from another thread.
+auto FakeTraits::close(handle_type handle) noexcept -> void
+{
+    g_closed.push_back(handle);
+    if (g_pool != nullptr)
+    {
+        auto probe = std::async(std::launch::async, [] { return g_pool->size(); });
+        if (probe.wait_for(1s) != std::future_status::ready)
+        {
+            std::printf("FAIL: handle %d closed under the pool lock\n", handle);
+            std::fflush(stdout);
+            std::_Exit(1);
+        }
+    }
+}
+
+auto check(bool condition, const char *what, int &failures) -> void
+{
+    if (!condition)
+    {
+        std::printf("FAIL: %s\n", what);
+        ++failures;
+    }
+}
+
+auto closed(std::vector<int> expected) -> bool
+{
+    const bool same = g_closed == expected;
+    g_closed.clear();
+    return same;
+}
+
+constexpr auto kFast = cpp_core::SerialConfig::make<115200, 8>();
+constexpr auto kSlow = cpp_core::SerialConfig::make<9600, 8>();
+
+auto flushOk(int /*handle*/) -> bool
+{
+    return true;
+}
+
+auto flushFails(int /*handle*/) -> bool
+{
+    return false;
+}
+
+// park() takes the handle by value, so a handle it refuses is closed once the call's statement ends.
+auto checkParking(Pool &pool, int &failures) -> void
+{
+    bool parked = pool.park("/dev/ttyUSB0", kFast, Resource{1}, flushOk);
+    check(!parked && !pool.enabled() && closed({1}), "a disabled pool closes instead of parking", failures);
+
+    pool.setOptions(2, 0ms);
+    parked = pool.park("/dev/ttyUSB0", kFast, Resource{2}, flushFails);
+    check(!parked && pool.enabled() && closed({2}), "a failed flush closes instead of parking", failures);
+    parked = pool.park("/dev/ttyUSB0", kFast, Resource{}, flushOk);
+    check(!parked && pool.size() == 0 && closed({}), "an invalid handle is not parked", failures);
+
+    check(!pool.acquire("/dev/ttyUSB0", kFast), "an empty pool misses", failures);
+    parked = pool.park("/dev/ttyUSB0", kFast, Resource{3}, flushOk);
+    check(parked && !pool.acquire("/dev/ttyUSB0", kSlow) && !pool.acquire("/dev/ttyUSB1", kFast) && pool.size() == 1,
+          "path and config must both match", failures);
+    check(pool.acquire("/dev/ttyUSB0", kFast).release() == 3 && pool.size() == 0 && closed({}),
+          "a match hands the parked handle back", failures);
+}
+
+auto checkEviction(Pool &pool, int &failures) -> void
+{
+    pool.setOptions(2, 0ms);
+    (void)pool.park("/dev/ttyUSB0", kFast, Resource{10}, flushOk);
+    (void)pool.park("/dev/ttyUSB1", kFast, Resource{11}, flushOk);
+    (void)pool.park("/dev/ttyUSB0", kFast, Resource{12}, flushOk);
+    check(pool.size() == 2 && closed({10}), "max_idle evicts the oldest handle", failures);
+    (void)pool.park("/dev/ttyUSB0", kFast, Resource{13}, flushOk);
+    check(closed({11}), "eviction ignores the key", failures);
+    check(pool.acquire("/dev/ttyUSB0", kFast).release() == 13 && pool.acquire("/dev/ttyUSB0", kFast).release() == 12,
+          "the most recently parked handle is taken first", failures);
+
+    pool.setOptions(4, 100ms);
+    (void)pool.park("/dev/ttyUSB0", kFast, Resource{20}, flushOk);
+    FakeClock::current += 60ms;
+    (void)pool.park("/dev/ttyUSB0", kFast, Resource{21}, flushOk);
+    FakeClock::current += 40ms;
+    check(pool.acquire("/dev/ttyUSB0", kFast).release() == 21 && closed({20}),
+          "idle_timeout expires handles on the next pool call", failures);
+    (void)pool.park("/dev/ttyUSB0", kFast, Resource{22}, flushOk);
+    FakeClock::current += 100ms;
+    check(!pool.acquire("/dev/ttyUSB0", kFast) && closed({22}), "acquire never returns an expired handle", failures);
+
+    (void)pool.park("/dev/ttyUSB0", kFast, Resource{30}, flushOk);
+    (void)pool.park("/dev/ttyUSB1", kSlow, Resource{31}, flushOk);
+    pool.setOptions(1, 0ms);
+    check(pool.size() == 1 && closed({30}), "lowering max_idle evicts at once", failures);
+    pool.setOptions(0, 0ms);
+    check(pool.size() == 0 && closed({31}) && !pool.enabled(), "max_idle 0 disables and empties the pool",
+          failures);
+
+    pool.setOptions(4, 0ms);
+    (void)pool.park("/dev/ttyUSB0", kFast, Resource{40}, flushOk);
+    (void)pool.park("/dev/ttyUSB1", kFast, Resource{41}, flushOk);
+    (void)pool.park("/dev/ttyUSB0", kSlow, Resource{42}, flushOk);
+    check(pool.evict("/dev/ttyUSB0") == 2 && pool.size() == 1 && closed({40, 42}),
+          "evict() closes every handle parked for the path", failures);
+    (void)pool.park("/dev/ttyUSB0", kFast, Resource{43}, flushOk);
+    check(pool.clear() == 2 && pool.size() == 0 && closed({41, 43}) && pool.enabled(),
+          "clear() closes every handle and keeps the options", failures);
+}
+
+auto measureRound(Pool &pool) -> void
+{
+    constexpr int kRounds = 1'000'000;
+    pool.setOptions(8, 0ms);
+    (void)pool.park("/dev/ttyUSB1", kFast, Resource{50}, flushOk);
+    const auto start = std::chrono::steady_clock::now();
+    int handle = 51;
+    for (int i = 0; i < kRounds; ++i)
+    {
+        (void)pool.park("/dev/ttyUSB0", kFast, Resource{handle}, flushOk);
+        handle = pool.acquire("/dev/ttyUSB0", kFast).release();
+    }
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    std::printf("handle_pool park + acquire: %.1f ns/round\n", elapsed.count() / kRounds);
+    pool.setOptions(0, 0ms);
+    g_closed.clear();
+}
+
+} // namespace
+
+auto main() -> int
+{
+    int failures = 0;
+    {
+        Pool pool;
+        g_pool = &pool;
+        checkParking(pool, failures);
+        checkEviction(pool, failures);
+        g_pool = nullptr;
+        measureRound(pool);
+    }
+    std::printf("handle_pool: %d failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
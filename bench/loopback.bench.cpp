@@ -0,0 +1,509 @@
+// End-to-end check of the loopback binding through the plain serial.h ABI: null-modem transfer, baud-rate
+// pacing, modem lines, line reads, zero-copy receive, poll, the submission queue, per-handle callbacks, the
+// wait handle, latency histograms, call tracing, capture/replay and the warm-reopen pool. Also prints unpaced
+// throughput, i.e. the binding's own cost per byte.
+
+#include "cpp_core/serial.h"
+#include "cpp_core/status_code.h"
+#include "cpp_core/strong_types.hpp"
+
+#include <poll.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int kThroughputBytes = 64 * 1024 * 1024;
+
+auto check(bool condition, const char *what, int &failures) -> void
+{
+    if (!condition)
+    {
+        std::printf("FAIL: %s\n", what);
+        ++failures;
+    }
+}
+
+auto openPort(const char *path, int baudrate = 115200) -> std::int64_t
+{
+    return serialOpen(const_cast<char *>(path), baudrate, 8, 0, 0, nullptr);
+}
+
+auto writeText(std::int64_t handle, std::string_view text) -> int
+{
+    return serialWrite(handle, text.data(), static_cast<int>(text.size()), 100, 1, nullptr);
+}
+
+auto elapsedMs(Clock::time_point start) -> double
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+std::atomic<int> g_callback_bytes{0};
+
+auto countBytes(std::int64_t /*handle*/, const void * /*data*/, int size, void * /*user_data*/) -> void
+{
+    g_callback_bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+auto checkPair(int &failures) -> void
+{
+    const auto left = openPort("loop://pair/0?unpaced");
+    const auto right = openPort("loop://pair/1?unpaced");
+    check(left > 0 && right > 0, "both ends of a pair open", failures);
+    check(openPort("loop://pair/0") < 0, "an end opens only once", failures);
+
+    std::array<char, 32> buffer{};
+    check(writeText(left, "hello") == 5, "write reports the byte count", failures);
+    check(serialReadFor(right, buffer.data(), 5, 100, nullptr) == 5 && std::string_view(buffer.data(), 5) == "hello",
+          "bytes arrive at the other end", failures);
+    check(serialReadFor(left, buffer.data(), 1, 0, nullptr) == 0, "nothing echoes back to the writer", failures);
+
+    check(writeText(left, "one\ntwo\n") == 8, "line write", failures);
+    check(serialReadLine(right, buffer.data(), static_cast<int>(buffer.size()), 100, 1, nullptr) == 4,
+          "readLine stops after the newline", failures);
+    check(serialInBytesWaiting(right, nullptr) == 4, "surplus stays buffered", failures);
+    check(serialReadLine(right, buffer.data(), static_cast<int>(buffer.size()), 100, 1, nullptr) == 4 &&
+              std::string_view(buffer.data(), 4) == "two\n",
+          "second readLine returns the surplus", failures);
+
+    check(serialGetDsr(right, nullptr) == 1 && serialGetCts(right, nullptr) == 1, "lines start asserted", failures);
+    check(serialSetDtr(left, 0, nullptr) == 0 && serialGetDsr(right, nullptr) == 0, "DTR drives the peer's DSR",
+          failures);
+    check(serialSetRts(left, 0, nullptr) == 0 && serialGetCts(right, nullptr) == 0, "RTS drives the peer's CTS",
+          failures);
+    check(serialGetRi(right, nullptr) == 0, "RI stays low", failures);
+    check(serialSetDtr(left, 1, nullptr) == 0 && serialSetRts(left, 1, nullptr) == 0, "lines re-assert", failures);
+
+    cpp_core::SerialStats stats{};
+    check(serialGetStats(right, &stats, nullptr) == 0 && serialInBytesTotal(right, nullptr) == 13,
+          "stats count received bytes", failures);
+
+    check(serialClose(left, nullptr) == 0 && serialClose(right, nullptr) == 0, "both ends close", failures);
+    check(serialGetBaudrate(left, nullptr) == static_cast<int>(cpp_core::StatusCode::Connection::kInvalidHandleError),
+          "closed handle is rejected", failures);
+}
+
+auto checkPacing(int &failures) -> void
+{
+    // 9600 8N1 is ten bits per byte: 96 bytes take 100 ms on the wire.
+    const auto left = openPort("loop://paced/0", 9600);
+    const auto right = openPort("loop://paced/1", 9600);
+    std::array<std::byte, 96> buffer{};
+    const auto start = Clock::now();
+    check(serialWrite(left, buffer.data(), static_cast<int>(buffer.size()), 100, 1, nullptr) == 96,
+          "paced write is accepted", failures);
+    check(serialReadFor(right, buffer.data(), static_cast<int>(buffer.size()), 1000, nullptr) == 96,
+          "paced read completes", failures);
+    const auto ms = elapsedMs(start);
+    check(ms >= 90.0 && ms < 400.0, "96 bytes at 9600 baud take about 100 ms", failures);
+    std::printf("loopback pacing: 96 bytes at 9600 8N1 in %.1f ms (expected 100)\n", ms);
+    (void)serialClose(left, nullptr);
+    (void)serialClose(right, nullptr);
+}
+
+auto checkEcho(int &failures) -> void
+{
+    const auto port = openPort("loop://echo?unpaced");
+    std::array<char, 8> buffer{};
+    check(writeText(port, "ping") == 4 && serialReadFor(port, buffer.data(), 4, 100, nullptr) == 4,
+          "an echo port reads back its own writes", failures);
+
+    // Zero-copy receive: the bytes are visible in place until released.
+    const void *data = nullptr;
+    int size = 0;
+    check(writeText(port, "abc") == 3, "echo write", failures);
+    check(serialRxAcquire(port, &data, &size, 100, nullptr) == 3 && size == 3 &&
+              std::memcmp(data, "abc", 3) == 0,
+          "rxAcquire exposes buffered bytes", failures);
+    check(serialRxRelease(port, 2, nullptr) == 0 && serialInBytesWaiting(port, nullptr) == 1,
+          "rxRelease consumes only what was released", failures);
+    check(serialClearBufferIn(port, nullptr) == 0 && serialInBytesWaiting(port, nullptr) == 0,
+          "clearBufferIn drops the rest", failures);
+    check(serialRxRelease(port, 0, nullptr) == static_cast<int>(cpp_core::StatusCode::Io::kBufferError),
+          "a release with nothing acquired fails", failures);
+
+    check(writeText(port, "xyz") == 3 && serialRxAcquire(port, &data, &size, 100, nullptr) == 3 &&
+              serialClearBufferIn(port, nullptr) == 0,
+          "clearBufferIn ends an outstanding acquisition", failures);
+    check(serialRxRelease(port, 3, nullptr) == 0 &&
+              serialRxRelease(port, 0, nullptr) == static_cast<int>(cpp_core::StatusCode::Io::kBufferError),
+          "only the first release after the clear is a no-op", failures);
+
+    std::array<cpp_core::PollEntry, 1> entries{
+        {{.handle = port, .events = cpp_core::toInt(cpp_core::PollEvent::kReadable), .revents = 0}}};
+    check(serialPoll(entries.data(), 1, 0, nullptr) == 0, "poll times out on an idle port", failures);
+    check(writeText(port, "x") == 1 && serialPoll(entries.data(), 1, 100, nullptr) == 1 &&
+              entries[0].revents == cpp_core::toInt(cpp_core::PollEvent::kReadable),
+          "poll reports the port readable", failures);
+
+    const auto wait_fd = serialGetWaitHandle(port, nullptr);
+    pollfd descriptor{.fd = static_cast<int>(wait_fd), .events = POLLIN, .revents = 0};
+    check(wait_fd >= 0 && ::poll(&descriptor, 1, 0) == 1, "wait handle signals pending bytes", failures);
+    check(serialClearBufferIn(port, nullptr) == 0 && ::poll(&descriptor, 1, 0) == 0,
+          "wait handle clears with the buffer", failures);
+
+    std::array<char, 16> read_buffer{};
+    const std::array<cpp_core::QueueSubmission, 2> submissions{{
+        {.user_data = 1,
+         .handle = port,
+         .op = cpp_core::toInt(cpp_core::QueueOp::kWrite),
+         .timeout_ms = 100,
+         .multiplier = 1,
+         .buffer_size = 6,
+         .buffer = const_cast<char *>("queued"),
+         .sequence = nullptr,
+         .sequence_size = 0},
+        {.user_data = 2,
+         .handle = port,
+         .op = cpp_core::toInt(cpp_core::QueueOp::kRead),
+         .timeout_ms = 100,
+         .multiplier = 1,
+         .buffer_size = 6,
+         .buffer = read_buffer.data(),
+         .sequence = nullptr,
+         .sequence_size = 0},
+    }};
+    std::array<cpp_core::QueueCompletion, 2> completions{};
+    check(serialSubmit(submissions.data(), 2, nullptr) == 2, "submit accepts both operations", failures);
+    check(serialReap(completions.data(), 2, 2, 1000, nullptr) == 2, "reap collects both completions", failures);
+    check(completions[0].result == 6 && completions[1].result == 6 &&
+              std::string_view(read_buffer.data(), 6) == "queued",
+          "queued read sees the queued write", failures);
+
+    check(serialSetHandleReadCallback(port, &countBytes, nullptr, nullptr) == 0, "read callback registers", failures);
+    check(writeText(port, "pushed") == 6, "write with a read callback", failures);
+    for (int i = 0; i < 100 && g_callback_bytes.load() < 6; ++i)
+    {
+        ::usleep(1000);
+    }
+    check(g_callback_bytes.load() == 6, "read callback receives the bytes", failures);
+    check(serialSetHandleReadCallback(port, nullptr, nullptr, nullptr) == 0, "read callback unregisters", failures);
+
+    check(serialSendBreak(port, 0, nullptr) == static_cast<int>(cpp_core::StatusCode::Control::kSendBreakError),
+          "zero-length break is rejected", failures);
+    (void)serialClose(port, nullptr);
+}
+
+// Calls recorded for @p op on @p handle, counting only those that took at least @p at_least_ns.
+auto recordedCalls(std::int64_t handle, cpp_core::LatencyOp op, std::int64_t at_least_ns = 0) -> std::int64_t
+{
+    const int op_value = cpp_core::toInt(op);
+    std::vector<cpp_core::LatencyBucket> buckets(
+        static_cast<std::size_t>(std::max(0, serialGetLatencyHistogram(handle, op_value, nullptr, 0, nullptr))));
+    if (buckets.empty() ||
+        serialGetLatencyHistogram(handle, op_value, buckets.data(), static_cast<int>(buckets.size()), nullptr) < 0)
+    {
+        return -1;
+    }
+    std::int64_t calls = 0;
+    for (const auto &bucket : buckets)
+    {
+        calls += bucket.upper_ns >= at_least_ns ? bucket.count : 0;
+    }
+    return calls;
+}
+
+auto checkLatency(int &failures) -> void
+{
+    using cpp_core::LatencyOp;
+    const auto untimed = openPort("loop://untimed?unpaced");
+    check(serialGetLatencyHistogram(untimed, 0, nullptr, 0, nullptr) == 0, "histograms are opt-in", failures);
+    check(serialGetLatencyHistogram(untimed, 6, nullptr, 0, nullptr) ==
+              static_cast<int>(cpp_core::StatusCode::Io::kBufferError),
+          "unknown op is rejected", failures);
+    (void)serialClose(untimed, nullptr);
+
+    check(serialSetLatencyHistograms(1, nullptr) == 0, "histograms enable", failures);
+    const auto left = openPort("loop://timed/0", 9600);
+    const auto right = openPort("loop://timed/1", 9600);
+    std::array<char, 16> buffer{};
+    check(writeText(left, "0123456789") == 10 && serialDrain(left, nullptr) == 0, "timed write and drain", failures);
+    check(serialReadFor(right, buffer.data(), 10, 100, nullptr) == 10, "timed read", failures);
+    check(writeText(left, "ok\n") == 3 &&
+              serialReadLine(right, buffer.data(), static_cast<int>(buffer.size()), 100, 1, nullptr) == 3,
+          "timed line read", failures);
+    check(recordedCalls(left, LatencyOp::kOpen) == 1 && recordedCalls(left, LatencyOp::kWrite) == 2 &&
+              recordedCalls(left, LatencyOp::kDrain) == 1,
+          "writer side records open, write and drain", failures);
+    // Ten characters at 9600 8N1 take about 10.4 ms on the wire.
+    check(recordedCalls(left, LatencyOp::kDrain, 9'000'000) == 1, "drain latency reflects wire time", failures);
+    check(recordedCalls(right, LatencyOp::kRead) == 1 && recordedCalls(right, LatencyOp::kReadUntil) == 1 &&
+              recordedCalls(right, LatencyOp::kWrite) == 0,
+          "reader side records read and delimiter read", failures);
+    (void)serialClose(left, nullptr);
+    (void)serialClose(right, nullptr);
+    check(recordedCalls(0, LatencyOp::kClose) == 2 && recordedCalls(0, LatencyOp::kOpen) == 2,
+          "binding-wide histograms keep open and close", failures);
+    check(serialSetLatencyHistograms(0, nullptr) == 0, "histograms disable", failures);
+}
+
+auto fileText(const char *path) -> std::string
+{
+    std::string text;
+    if (std::FILE *file = std::fopen(path, "r"))
+    {
+        std::array<char, 4096> chunk{};
+        for (std::size_t got = 0; (got = std::fread(chunk.data(), 1, chunk.size(), file)) > 0;)
+        {
+            text.append(chunk.data(), got);
+        }
+        std::fclose(file);
+    }
+    return text;
+}
+
+// Nanoseconds per serialInBytesWaiting() call, the cheapest traced entry point.
+auto nsPerCall(std::int64_t handle) -> double
+{
+    constexpr int kCalls = 200'000;
+    const auto start = Clock::now();
+    for (int i = 0; i < kCalls; ++i)
+    {
+        (void)serialInBytesWaiting(handle, nullptr);
+    }
+    return elapsedMs(start) * 1e6 / kCalls;
+}
+
+// Fresh empty file under /tmp; empty string if it could not be created.
+auto tempFile() -> std::string
+{
+    std::string path = "/tmp/cpp_core_benchXXXXXX";
+    const int fd = mkstemp(path.data());
+    if (fd < 0)
+    {
+        return {};
+    }
+    close(fd);
+    return path;
+}
+
+auto checkTracing(int &failures) -> void
+{
+    const auto path = tempFile();
+    check(!path.empty(), "trace file created", failures);
+    if (path.empty())
+    {
+        return;
+    }
+
+    const auto port = openPort("loop://traced?unpaced");
+    const double untraced_ns = nsPerCall(port);
+    check(serialSetTracing(1, nullptr) == 0, "tracing enables", failures);
+    const double traced_ns = nsPerCall(port);
+    std::array<char, 8> buffer{};
+    check(writeText(port, "trace") == 5 && serialReadFor(port, buffer.data(), 5, 100, nullptr) == 5,
+          "traced echo", failures);
+    check(serialRead(port, nullptr, 1, 0, 1, nullptr) == static_cast<int>(cpp_core::StatusCode::Io::kBufferError),
+          "traced rejection", failures);
+    (void)serialClose(port, nullptr);
+    check(serialSetTracing(0, nullptr) == 0, "tracing disables", failures);
+    check(serialTraceDump(nullptr, nullptr) == static_cast<int>(cpp_core::StatusCode::Io::kBufferError),
+          "null trace path is rejected", failures);
+
+    // Only the rings' 4096 most recent calls survive the timing loop; the calls after it are all there.
+    check(serialTraceDump(path.c_str(), nullptr) >= 4, "trace dump writes events", failures);
+    const auto text = fileText(path.c_str());
+    check(text.starts_with("{\"displayTimeUnit\"") && text.contains("\"name\":\"serialWrite\"") &&
+              text.contains("\"name\":\"serialReadFor\"") && text.contains("\"name\":\"serialClose\"") &&
+              text.contains("\"name\":\"serialRead\""),
+          "trace names the exported calls", failures);
+    check(!text.contains("serialOpen"), "calls before enabling are not traced", failures);
+    std::remove(path.c_str());
+    std::printf("tracing overhead: %.1f ns/call disabled, %.1f ns/call enabled (serialInBytesWaiting)\n", untraced_ns,
+                traced_ns);
+}
+
+auto readLineText(std::int64_t handle, int timeout_ms) -> std::string
+{
+    std::array<char, 32> line{};
+    const int got = serialReadLine(handle, line.data(), static_cast<int>(line.size()), timeout_ms, 1, nullptr);
+    return {line.data(), static_cast<std::size_t>(std::max(got, 0))};
+}
+
+// Milliseconds a replay of @p path takes from its first line to its second.
+auto replayGapMs(const std::string &path) -> double
+{
+    const auto port = openPort(path.c_str());
+    (void)readLineText(port, 500);
+    const auto start = Clock::now();
+    const bool second = readLineText(port, 500) == "world\n";
+    const auto ms = elapsedMs(start);
+    (void)serialClose(port, nullptr);
+    return second ? ms : -1.0;
+}
+
+auto checkCapture(int &failures) -> void
+{
+    const auto path = tempFile();
+    check(!path.empty(), "capture file created", failures);
+    if (path.empty())
+    {
+        return;
+    }
+    const auto left = openPort("loop://cap/0?unpaced");
+    const auto right = openPort("loop://cap/1?unpaced");
+    check(serialCaptureStart(right, nullptr, nullptr) == static_cast<int>(cpp_core::StatusCode::Io::kBufferError),
+          "null capture path is rejected", failures);
+    check(serialCaptureStart(right, path.c_str(), nullptr) == 0, "capture starts", failures);
+    check(writeText(left, "hello\n") == 6 && readLineText(right, 100) == "hello\n", "captured first line", failures);
+    std::this_thread::sleep_for(std::chrono::milliseconds{60});
+    check(writeText(left, "world\n") == 6 && readLineText(right, 100) == "world\n", "captured second line",
+          failures);
+    check(writeText(right, "ack") == 3 && serialSetDtr(left, 0, nullptr) == 0, "captured write and DSR drop",
+          failures);
+    check(serialCaptureStop(right, nullptr) == 0 && serialCaptureStop(right, nullptr) == 0, "capture stops",
+          failures);
+    (void)serialClose(left, nullptr);
+    (void)serialClose(right, nullptr);
+
+    const auto timed = openPort(("replay://" + path).c_str());
+    check(timed > 0 && serialGetDsr(timed, nullptr) == 1, "replay starts with the captured line state", failures);
+    (void)serialClose(timed, nullptr);
+
+    // Unpaced, everything is due at once: the DSR drop is replayed as soon as the ring has taken the lines.
+    const auto fast = openPort(("replay://" + path + "?unpaced").c_str());
+    check(readLineText(fast, 100) == "hello\n" && readLineText(fast, 100) == "world\n",
+          "replay serves the received lines", failures);
+    check(serialGetDsr(fast, nullptr) == 0, "replay plays back the DSR drop", failures);
+    std::array<char, 4> rest{};
+    check(serialWrite(fast, "x", 1, 0, 1, nullptr) == 1 && serialReadFor(fast, rest.data(), 4, 20, nullptr) == 0,
+          "replay drops writes and sent data", failures);
+    (void)serialClose(fast, nullptr);
+
+    // The lines were captured 60 ms apart.
+    const double real_ms = replayGapMs("replay://" + path);
+    const double fast_ms = replayGapMs("replay://" + path + "?speed=4");
+    check(real_ms >= 50.0 && real_ms < 200.0, "replay keeps the captured timing", failures);
+    check(fast_ms >= 10.0 && fast_ms < 40.0, "replay speed scales the timing", failures);
+    check(openPort("replay:///nonexistent/cpp_core.cap") ==
+              static_cast<int>(cpp_core::StatusCode::Connection::kNotFoundError),
+          "missing capture is not found", failures);
+    check(openPort(("replay://" + path + "?speed=0").c_str()) ==
+              static_cast<int>(cpp_core::StatusCode::Connection::kNotFoundError),
+          "zero speed is rejected", failures);
+    std::remove(path.c_str());
+    std::printf("loopback replay: captured 60 ms gap replayed in %.1f ms, %.1f ms at speed 4\n", real_ms, fast_ms);
+}
+
+auto checkPool(int &failures) -> void
+{
+    const auto cold_start = Clock::now();
+    const auto first = openPort("loop://pooled?unpaced");
+    const auto cold_ms = elapsedMs(cold_start);
+    check(serialSetPoolOptions(4, 0, nullptr) == 0, "pool enables", failures);
+    check(writeText(first, "stale") == 5 && serialClose(first, nullptr) == 0, "close parks the handle", failures);
+
+    const auto warm_start = Clock::now();
+    const auto again = openPort("loop://pooled?unpaced");
+    const auto warm_ms = elapsedMs(warm_start);
+    std::array<char, 8> buffer{};
+    check(again == first, "reopen with the same config returns the parked handle", failures);
+    check(serialReadFor(again, buffer.data(), 5, 0, nullptr) == 0, "the parked handle starts without stale input",
+          failures);
+    check(serialClose(again, nullptr) == 0 && serialClearPool(nullptr) == 1, "clearing the pool closes it",
+          failures);
+    const auto fresh = openPort("loop://pooled?unpaced");
+    check(fresh > 0 && fresh != first, "after clearing, open creates a new handle", failures);
+    check(serialClose(fresh, nullptr) == 0 && serialClearPool(nullptr) == 1, "the new handle is parked in turn",
+          failures);
+
+    // Parking resets the handle the way closing it would; reopening raises the lines again.
+    const auto left = openPort("loop://pooled-pair/0?unpaced");
+    const auto right = openPort("loop://pooled-pair/1?unpaced");
+    std::array<char, 2> received{};
+    check(writeText(right, "in") == 2 && serialReadFor(left, received.data(), 2, 100, nullptr) == 2 &&
+              serialInBytesTotal(left, nullptr) == 2,
+          "pooled pair transfers", failures);
+    std::atomic<int> blocked_read{0};
+    std::thread reader([&] {
+        std::array<char, 8> unused{};
+        blocked_read = serialReadFor(left, unused.data(), static_cast<int>(unused.size()), 2000, nullptr);
+    });
+    const auto capture_path = tempFile();
+    check(serialCaptureStart(left, capture_path.c_str(), nullptr) == 0, "pooled handle captures", failures);
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    const auto park_start = Clock::now();
+    check(serialClose(left, nullptr) == 0, "close parks one end of a pair", failures);
+    reader.join();
+    // The recorder buffers everything until it is closed.
+    check(fileText(capture_path.c_str()).starts_with("CPPCAP"), "parking ends the capture", failures);
+    std::remove(capture_path.c_str());
+    check(blocked_read == static_cast<int>(cpp_core::StatusCode::Io::kAbortReadError) && elapsedMs(park_start) < 500.0,
+          "parking aborts a blocked read", failures);
+    check(serialGetDsr(right, nullptr) == 0 && serialGetCts(right, nullptr) == 0 && serialGetDcd(right, nullptr) == 0,
+          "the peer sees the parked end's lines drop", failures);
+    const auto reopened = openPort("loop://pooled-pair/0?unpaced");
+    check(reopened == left && serialGetDsr(right, nullptr) == 1 && serialGetCts(right, nullptr) == 1,
+          "reopening raises the lines again", failures);
+    check(serialInBytesTotal(reopened, nullptr) == 0, "parking resets the statistics", failures);
+    (void)serialClose(reopened, nullptr);
+    const auto other_speed = openPort("loop://pooled-pair/0?unpaced", 9600);
+    check(other_speed > 0 && other_speed != left, "reopening with other settings closes the parked handle",
+          failures);
+    check(serialClearPool(nullptr) == 0, "the evicted handle left the pool", failures);
+    (void)serialClose(other_speed, nullptr);
+    (void)serialClose(right, nullptr);
+
+    check(serialSetPoolOptions(0, 0, nullptr) == 0 && serialClearPool(nullptr) == 0, "pool disables", failures);
+    std::printf("loopback pool: cold open %.3f ms, warm reopen %.3f ms\n", cold_ms, warm_ms);
+}
+
+auto measureThroughput(int &failures) -> void
+{
+    const auto left = openPort("loop://bulk/0?unpaced");
+    const auto right = openPort("loop://bulk/1?unpaced");
+    std::vector<std::byte> chunk(4096);
+    std::vector<std::byte> sink(chunk.size());
+    std::int64_t moved = 0;
+    const auto start = Clock::now();
+    while (moved < kThroughputBytes)
+    {
+        const auto written = serialWrite(left, chunk.data(), static_cast<int>(chunk.size()), 100, 1, nullptr);
+        const auto read = serialReadFor(right, sink.data(), written, 100, nullptr);
+        if (written <= 0 || read != written)
+        {
+            check(false, "unpaced bulk transfer", failures);
+            break;
+        }
+        moved += read;
+    }
+    const auto ms = elapsedMs(start);
+    std::printf("loopback throughput: %.0f MiB/s unpaced (4 KiB write + read per round)\n",
+                static_cast<double>(moved) / (1024.0 * 1024.0) / (ms / 1000.0));
+    (void)serialClose(left, nullptr);
+    (void)serialClose(right, nullptr);
+}
+
+} // namespace
+
+auto main() -> int
+{
+    int failures = 0;
+    checkPair(failures);
+    checkPacing(failures);
+    checkEcho(failures);
+    checkLatency(failures);
+    checkTracing(failures);
+    checkCapture(failures);
+    checkPool(failures);
+    measureThroughput(failures);
+
+    std::printf("loopback: %d failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,86 @@
+// Throughput check for cpp_core::RingBuffer: one producer thread streams a counter pattern through
+// the ring in varying chunk sizes while the consumer verifies every byte. Exits non-zero on corruption.
+
+#include "cpp_core/ring_buffer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <thread>
+
+namespace
+{
+
+constexpr std::size_t kTotalBytes = std::size_t{64} << 20;
+constexpr std::size_t kMaxChunk = 1500;
+
+auto patternByte(std::size_t index) -> std::byte
+{
+    return static_cast<std::byte>((index * 31U) >> 3U);
+}
+
+// Small xorshift so chunk sizes vary without pulling in <random>.
+auto nextChunk(std::uint32_t &state) -> std::size_t
+{
+    state ^= state << 13U;
+    state ^= state >> 17U;
+    state ^= state << 5U;
+    return 1 + (state % kMaxChunk);
+}
+
+} // namespace
+
+auto main() -> int
+{
+    auto ring = std::make_unique<cpp_core::RingBuffer<std::size_t{1} << 16>>();
+    const auto start = std::chrono::steady_clock::now();
+
+    std::thread producer([&ring] {
+        std::uint32_t state = 0x12345678U;
+        std::size_t sent = 0;
+        while (sent < kTotalBytes)
+        {
+            auto space = ring->prepareWrite();
+            if (space.empty())
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            const auto chunk = std::min({space.size(), nextChunk(state), kTotalBytes - sent});
+            for (std::size_t i = 0; i < chunk; ++i)
+            {
+                space[i] = patternByte(sent + i);
+            }
+            ring->commitWrite(chunk);
+            sent += chunk;
+        }
+    });
+
+    std::size_t received = 0;
+    std::size_t mismatches = 0;
+    while (received < kTotalBytes)
+    {
+        const auto data = ring->prepareRead();
+        if (data.empty())
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        for (std::size_t i = 0; i < data.size(); ++i)
+        {
+            mismatches += data[i] != patternByte(received + i) ? 1U : 0U;
+        }
+        ring->commitRead(data.size());
+        received += data.size();
+    }
+    producer.join();
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    const double mib = static_cast<double>(kTotalBytes) / (1024.0 * 1024.0);
+    std::printf("ring_buffer: %.0f MiB in %.3f s (%.1f MiB/s), %zu mismatches\n", mib, elapsed.count(),
+                mib / elapsed.count(), mismatches);
+    return mismatches == 0 ? 0 : 1;
+}
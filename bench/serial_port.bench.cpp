@@ -0,0 +1,140 @@
+// Overhead check for the SerialPort wrapper: the same serialRead() / serialWrite() calls are made raw
+// through the C ABI and through SerialPort, against stub definitions in this file (kept out of line so
+// both sides pay one real call). Also verifies that failures surface as Result with the code and message
+// the binding reported, and that close() / the destructor reach serialClose() exactly once.
+
+#include "cpp_core/serial_port.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <string_view>
+
+namespace
+{
+
+constexpr std::int64_t kGoodHandle = 7;
+constexpr std::int64_t kBrokenHandle = 9;
+constexpr int kIterations = 20'000'000;
+
+constexpr const char *kBrokenMessage = "Read failed: device /dev/serial/by-id/usb-FTDI_FT232R_USB_UART-if00 gone away";
+int g_closes = 0;
+
+auto stubTransfer(std::int64_t handle, int buffer_size, ErrorCallbackT error_callback) -> int
+{
+    if (handle != kGoodHandle)
+    {
+        if (error_callback != nullptr)
+        {
+            error_callback(static_cast<int>(cpp_core::StatusCode::Io::kReadError), kBrokenMessage);
+        }
+        return static_cast<int>(cpp_core::StatusCode::Io::kReadError);
+    }
+    return buffer_size;
+}
+
+} // namespace
+
+extern "C"
+{
+
+    [[gnu::noinline]] auto serialOpen(void * /*port*/, int /*baudrate*/, int /*data_bits*/, int /*parity*/,
+                                      int /*stop_bits*/, ErrorCallbackT /*error_callback*/) -> intptr_t
+    {
+        return kGoodHandle;
+    }
+
+    [[gnu::noinline]] auto serialClose(int64_t /*handle*/, ErrorCallbackT /*error_callback*/) -> int
+    {
+        ++g_closes;
+        return 0;
+    }
+
+    [[gnu::noinline]] auto serialRead(int64_t handle, void * /*buffer*/, int buffer_size, int /*timeout_ms*/,
+                                      int /*multiplier*/, ErrorCallbackT error_callback) -> int
+    {
+        return stubTransfer(handle, buffer_size, error_callback);
+    }
+
+    [[gnu::noinline]] auto serialWrite(int64_t handle, const void * /*buffer*/, int buffer_size, int /*timeout_ms*/,
+                                       int /*multiplier*/, ErrorCallbackT error_callback) -> int
+    {
+        return stubTransfer(handle, buffer_size, error_callback);
+    }
+
+} // extern "C"
+
+namespace
+{
+
+template <typename Fn> auto nsPerCall(Fn &&call) -> double
+{
+    std::size_t sink = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kIterations; ++i)
+    {
+        sink += call();
+    }
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    if (sink == 0)
+    {
+        std::printf("unexpected zero result\n");
+    }
+    return elapsed.count() / kIterations;
+}
+
+auto check(bool condition, const char *what, int &failures) -> void
+{
+    if (!condition)
+    {
+        std::printf("FAIL: %s\n", what);
+        ++failures;
+    }
+}
+
+} // namespace
+
+auto main() -> int
+{
+    using cpp_core::Multiplier;
+    using cpp_core::SerialPort;
+    using cpp_core::TimeoutMs;
+
+    int failures = 0;
+    std::array<std::byte, 64> buffer{};
+    {
+        auto opened = SerialPort::open("/dev/null", cpp_core::SerialConfig::make<115200, 8>());
+        check(opened.has_value() && opened->handle() == kGoodHandle, "open() adopts the handle", failures);
+        auto port = std::move(opened).value();
+
+        const auto read = port.read(buffer, TimeoutMs{10}, Multiplier{1});
+        check(read.has_value() && *read == buffer.size(), "read() returns the byte count", failures);
+        const auto written = port.write(std::span(buffer).first(5), TimeoutMs{10}, Multiplier{1});
+        check(written.has_value() && *written == 5, "write() returns the byte count", failures);
+
+        SerialPort broken{SerialPort::Handle{kBrokenHandle}};
+        const auto error = broken.read(buffer, TimeoutMs{10}, Multiplier{1});
+        check(!error.has_value() && error.error() == cpp_core::StatusCode::Io::kReadError, "failure maps to Error",
+              failures);
+        check(!error.has_value() && !error.error().message.empty() &&
+                  std::string_view{kBrokenMessage}.starts_with(error.error().message.view()),
+              "failure carries the binding's message", failures);
+        check(SerialPort::lastErrorText() == kBrokenMessage, "the full message stays readable", failures);
+        check(broken.close().has_value() && !broken.valid(), "close() reports success and releases", failures);
+
+        const auto raw_ns = nsPerCall([&] {
+            return static_cast<std::size_t>(serialRead(kGoodHandle, buffer.data(), static_cast<int>(buffer.size()),
+                                                       10, 1, nullptr));
+        });
+        const auto wrapped_ns =
+            nsPerCall([&] { return port.read(buffer, TimeoutMs{10}, Multiplier{1}).value_or(0); });
+        std::printf("serial_port read: raw %.2f ns/call  SerialPort %.2f ns/call\n", raw_ns, wrapped_ns);
+    }
+    check(g_closes == 2, "each handle is closed exactly once", failures);
+
+    std::printf("serial_port: %d failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
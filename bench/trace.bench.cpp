@@ -0,0 +1,93 @@
+// Concurrency check of trace::Ring: one thread pushes records whose fields all derive from a sequence
+// number while another collects. Every collected record must be whole (no fields from two pushes) and in
+// push order; a torn slot has to be dropped, not returned. Also prints the cost of a push.
+
+#include "cpp_core/trace.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using cpp_core::trace::Record;
+using cpp_core::trace::Ring;
+
+constexpr std::int64_t kPushes = 20'000'000;
+constexpr int kCollections = 20'000;
+
+auto recordFor(std::int64_t sequence) -> Record
+{
+    return Record{sequence,
+                  sequence * 3,
+                  -sequence,
+                  sequence ^ 0x5A5A,
+                  "traced",
+                  static_cast<std::int32_t>(sequence),
+                  static_cast<std::uint32_t>(sequence >> 32)};
+}
+
+auto whole(const Record &record) -> bool
+{
+    const auto expected = recordFor(record.start_ns);
+    return record.duration_ns == expected.duration_ns && record.handle == expected.handle &&
+           record.size == expected.size && record.name == expected.name && record.status == expected.status &&
+           record.thread == expected.thread;
+}
+
+} // namespace
+
+auto main() -> int
+{
+    auto ring = std::make_unique<Ring>();
+    std::atomic<bool> done{false};
+    std::int64_t torn = 0;
+    std::int64_t unordered = 0;
+    std::int64_t collected = 0;
+    int collections = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    std::thread owner([&] {
+        for (std::int64_t sequence = 0; sequence < kPushes; ++sequence)
+        {
+            ring->push(recordFor(sequence));
+        }
+        done.store(true, std::memory_order_release);
+    });
+    std::vector<Record> out;
+    out.reserve(cpp_core::trace::kRingRecords);
+    while (collections < kCollections || !done.load(std::memory_order_acquire))
+    {
+        out.clear();
+        ring->collect(out);
+        ++collections;
+        collected += static_cast<std::int64_t>(out.size());
+        for (std::size_t index = 0; index < out.size(); ++index)
+        {
+            torn += whole(out[index]) ? 0 : 1;
+            unordered += index > 0 && out[index].start_ns != out[index - 1].start_ns + 1 ? 1 : 0;
+        }
+    }
+    owner.join();
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+    // With the owner finished, a last collect sees a full, quiet ring.
+    out.clear();
+    ring->collect(out);
+    const bool tail = out.size() == cpp_core::trace::kRingRecords && out.back().start_ns == kPushes - 1;
+
+    std::printf("trace ring: %d collections, %lld records, %lld torn, %lld out of order, push %.1f ns under collect\n",
+                collections, static_cast<long long>(collected), static_cast<long long>(torn),
+                static_cast<long long>(unordered), elapsed.count() / kPushes);
+    if (torn != 0 || unordered != 0 || !tail)
+    {
+        std::printf("FAIL: trace ring returned %s\n", tail ? "torn or reordered records" : "a wrong tail");
+        return 1;
+    }
+    return 0;
+}
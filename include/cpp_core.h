@@ -8,15 +8,35 @@
  * wants the full API and helper layer in one include.
  */
 
+#include "cpp_core/async_port.hpp"
+#include "cpp_core/byte_search.hpp"
+#include "cpp_core/capture.hpp"
+#include "cpp_core/cobs.hpp"
+#include "cpp_core/crc.hpp"
+#include "cpp_core/data_callback.h"
+#include "cpp_core/deadline.hpp"
 #include "cpp_core/error_callback.h"
 #include "cpp_core/error_handling.hpp"
-#include "cpp_core/result.hpp"
+#include "cpp_core/framing.hpp"
+#include "cpp_core/handle_pool.hpp"
+#include "cpp_core/io_vec.h"
+#include "cpp_core/latency_histogram.hpp"
+#include "cpp_core/modbus_rtu.hpp"
+#include "cpp_core/read_ahead_buffer.hpp"
 #include "cpp_core/reflection.hpp"
+#include "cpp_core/result.hpp"
+#include "cpp_core/ring_buffer.hpp"
 #include "cpp_core/scope_guard.hpp"
 #include "cpp_core/serial.h"
 #include "cpp_core/serial_config.hpp"
+#include "cpp_core/serial_port.hpp"
+#include "cpp_core/slip.hpp"
+#include "cpp_core/stats_counters.hpp"
 #include "cpp_core/status_code.h"
+#include "cpp_core/status_table.hpp"
 #include "cpp_core/strong_types.hpp"
+#include "cpp_core/task.hpp"
+#include "cpp_core/trace.hpp"
 #include "cpp_core/unique_resource.hpp"
 #include "cpp_core/validation.hpp"
 #include "cpp_core/version.hpp"
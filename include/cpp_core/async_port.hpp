@@ -0,0 +1,478 @@
+#pragma once
+
+#include "byte_search.hpp"
+#include "framing.hpp"
+#include "result.hpp"
+#include "serial.h"
+#include "serial_config.hpp"
+#include "serial_port.hpp"
+#include "status_code.h"
+#include "strong_types.hpp"
+#include "task.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <generator>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace cpp_core
+{
+
+/**
+ * Single-threaded executor for Task coroutines. Suspended reads register a readiness wait and run() serves
+ * all of them with one serialPoll() per round, so one thread drives any number of ports; run one IoContext
+ * per thread to spread ports over a few threads.
+ *
+ * cancel() is the only member that may be called from another thread: it fails the handle's pending (or
+ * next) wait with Io::kAbortReadError and wakes the poll through serialAbortRead().
+ *   IoContext io;
+ *   io.spawn(pump(io, port));
+ *   auto finished = io.run();
+ */
+class IoContext
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+  private:
+    // One suspended readiness wait; lives in the awaiting coroutine's frame.
+    struct Wait
+    {
+        std::int64_t handle;
+        Clock::time_point deadline;
+        std::coroutine_handle<> coroutine{};
+        Result<bool> readable{false};
+    };
+
+  public:
+    // Awaitable for "handle is readable": true when ready, false when @p timeout expired first.
+    class ReadableAwaiter
+    {
+      public:
+        ReadableAwaiter(IoContext &context, std::int64_t handle, TimeoutMs timeout)
+            : context_(context), wait_{.handle = handle, .deadline = deadlineAfter(timeout)}
+        {
+        }
+
+        [[nodiscard]] static auto await_ready() noexcept -> bool
+        {
+            return false;
+        }
+
+        auto await_suspend(std::coroutine_handle<> awaiting) -> void
+        {
+            wait_.coroutine = awaiting;
+            context_.waits_.push_back(&wait_);
+        }
+
+        [[nodiscard]] auto await_resume() const -> Result<bool>
+        {
+            return wait_.readable;
+        }
+
+      private:
+        IoContext &context_;
+        Wait wait_;
+    };
+
+    IoContext() = default;
+
+    IoContext(const IoContext &) = delete;
+    auto operator=(const IoContext &) -> IoContext & = delete;
+
+    // Take ownership of a top-level task; it starts on the next run().
+    auto spawn(Task<> task) -> void
+    {
+        ready_.push_back(task.coroutine());
+        roots_.push_back(std::move(task));
+    }
+
+    // TimeoutMs{-1} waits without limit.
+    [[nodiscard]] auto readable(std::int64_t handle, TimeoutMs timeout) -> ReadableAwaiter
+    {
+        return ReadableAwaiter{*this, handle, timeout};
+    }
+
+    auto cancel(std::int64_t handle) -> Status
+    {
+        {
+            const std::scoped_lock lock(cancel_mutex_);
+            cancelled_.push_back(handle);
+        }
+        return detail::serial_port::toStatus(serialAbortRead(handle, &detail::serial_port::errorTrampoline));
+    }
+
+    /**
+     * Run until every spawned task has finished, or none can make progress. A serialPoll() failure fails
+     * the waits it covered and is returned once the loop ends. Exceptions escaping a spawned task are
+     * rethrown here.
+     */
+    auto run() -> Status
+    {
+        Status status;
+        while (true)
+        {
+            resumeReady();
+            sweepRoots();
+            if (roots_.empty() || waits_.empty())
+            {
+                break;
+            }
+            if (auto polled = pollOnce(); !polled && status)
+            {
+                status = std::move(polled);
+            }
+        }
+        return status;
+    }
+
+    // Spawned tasks that have not finished yet.
+    [[nodiscard]] auto pending() const noexcept -> std::size_t
+    {
+        return roots_.size();
+    }
+
+  private:
+    [[nodiscard]] static auto deadlineAfter(TimeoutMs timeout) -> Clock::time_point
+    {
+        return timeout.get() < 0 ? Clock::time_point::max() : Clock::now() + std::chrono::milliseconds{timeout.get()};
+    }
+
+    [[nodiscard]] static auto pollTimeoutMs(Clock::time_point deadline) -> int
+    {
+        if (deadline == Clock::time_point::max())
+        {
+            return -1;
+        }
+        const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline - Clock::now()).count();
+        return static_cast<int>(std::clamp<std::int64_t>(remaining, 0, INT_MAX));
+    }
+
+    auto complete(Wait &wait, Result<bool> readable) -> void
+    {
+        wait.readable = std::move(readable);
+        ready_.push_back(wait.coroutine);
+    }
+
+    auto resumeReady() -> void
+    {
+        while (!ready_.empty())
+        {
+            resuming_.swap(ready_);
+            for (const auto coroutine : resuming_)
+            {
+                coroutine.resume();
+            }
+            resuming_.clear();
+        }
+    }
+
+    auto sweepRoots() -> void
+    {
+        for (auto root = roots_.begin(); root != roots_.end();)
+        {
+            if (!root->done())
+            {
+                ++root;
+                continue;
+            }
+            auto finished = std::move(*root);
+            root = roots_.erase(root);
+            finished.result();
+        }
+    }
+
+    // Cancellations for handles without a pending wait are kept for that handle's next wait.
+    auto applyCancellations() -> bool
+    {
+        {
+            const std::scoped_lock lock(cancel_mutex_);
+            pending_cancels_.insert(pending_cancels_.end(), cancelled_.begin(), cancelled_.end());
+            cancelled_.clear();
+        }
+        if (pending_cancels_.empty())
+        {
+            return false;
+        }
+        const auto before = waits_.size();
+        std::erase_if(waits_, [this](Wait *wait) {
+            const auto match = std::ranges::find(pending_cancels_, wait->handle);
+            if (match == pending_cancels_.end())
+            {
+                return false;
+            }
+            pending_cancels_.erase(match);
+            complete(*wait, fail<bool>(StatusCode::Io::kAbortReadError));
+            return true;
+        });
+        return waits_.size() != before;
+    }
+
+    auto pollOnce() -> Status
+    {
+        if (applyCancellations())
+        {
+            return {};
+        }
+        entries_.clear();
+        auto deadline = Clock::time_point::max();
+        for (const auto *wait : waits_)
+        {
+            entries_.push_back(PollEntry{.handle = wait->handle, .events = toInt(PollEvent::kReadable), .revents = 0});
+            deadline = std::min(deadline, wait->deadline);
+        }
+        const auto polled = serialPoll(entries_.data(), detail::serial_port::clampSize(entries_.size()),
+                                       pollTimeoutMs(deadline), &detail::serial_port::errorTrampoline);
+        if (polled < 0)
+        {
+            const auto error = detail::serial_port::takeError(polled);
+            for (auto *wait : waits_)
+            {
+                complete(*wait, std::unexpected(error));
+            }
+            waits_.clear();
+            return std::unexpected(error);
+        }
+        // Any revents counts as ready: errors and hangups surface from the read that follows.
+        const auto now = Clock::now();
+        std::size_t kept = 0;
+        for (std::size_t index = 0; index < waits_.size(); ++index)
+        {
+            auto *wait = waits_[index];
+            if (entries_[index].revents != 0)
+            {
+                complete(*wait, true);
+            }
+            else if (wait->deadline <= now)
+            {
+                complete(*wait, false);
+            }
+            else
+            {
+                waits_[kept++] = wait;
+            }
+        }
+        waits_.resize(kept);
+        static_cast<void>(applyCancellations());
+        return {};
+    }
+
+    std::vector<Task<>> roots_;
+    std::vector<std::coroutine_handle<>> ready_;
+    std::vector<std::coroutine_handle<>> resuming_;
+    std::vector<Wait *> waits_;
+    std::vector<PollEntry> entries_;
+    std::vector<std::int64_t> pending_cancels_;
+
+    std::mutex cancel_mutex_;
+    std::vector<std::int64_t> cancelled_;
+};
+
+namespace detail::async
+{
+
+template <ByteBuffer Buffer> [[nodiscard]] auto writableBytes(Buffer &buffer) noexcept -> std::span<std::byte>
+{
+    return {static_cast<std::byte *>(static_cast<void *>(buffer.data())), static_cast<std::size_t>(buffer.size())};
+}
+
+} // namespace detail::async
+
+/**
+ * Coroutine view of a SerialPort driven by an IoContext. Reads first try the port without blocking and
+ * only suspend on serialPoll() readiness when nothing is pending, so a busy port costs no extra round.
+ *   auto pump(IoContext &io, SerialPort &port) -> Task<> {
+ *       AsyncPort async{io, port};
+ *       std::array<std::byte, 256> rx{};
+ *       std::array<std::byte, 256> frame{};
+ *       CobsDecoder decoder;
+ *       while (auto got = co_await async.read(rx)) {
+ *           for (auto packet : decodedFrames(decoder, std::span(rx).first(*got), frame)) { handle(packet); }
+ *       }
+ *   }
+ */
+class AsyncPort
+{
+  public:
+    class ReadAwaiter
+    {
+      public:
+        ReadAwaiter(AsyncPort &port, std::span<std::byte> buffer, TimeoutMs timeout)
+            : port_(port), buffer_(buffer), readable_(port.context_.readable(port.port_.handle(), timeout))
+        {
+        }
+
+        [[nodiscard]] auto await_ready() -> bool
+        {
+            result_ = port_.readNow(buffer_);
+            return !result_ || *result_ != 0;
+        }
+
+        auto await_suspend(std::coroutine_handle<> awaiting) -> void
+        {
+            suspended_ = true;
+            readable_.await_suspend(awaiting);
+        }
+
+        [[nodiscard]] auto await_resume() -> Result<std::size_t>
+        {
+            if (!suspended_)
+            {
+                return std::move(result_);
+            }
+            const auto readable = readable_.await_resume();
+            if (!readable)
+            {
+                return std::unexpected(readable.error());
+            }
+            if (!*readable)
+            {
+                return std::size_t{0};
+            }
+            return port_.readNow(buffer_);
+        }
+
+      private:
+        AsyncPort &port_;
+        std::span<std::byte> buffer_;
+        IoContext::ReadableAwaiter readable_;
+        Result<std::size_t> result_{std::size_t{0}};
+        bool suspended_{false};
+    };
+
+    AsyncPort(IoContext &context, SerialPort &port) noexcept : context_(context), port_(port)
+    {
+    }
+
+    [[nodiscard]] auto port() const noexcept -> SerialPort &
+    {
+        return port_;
+    }
+
+    // Up to buffer.size() bytes, 0 on timeout. TimeoutMs{-1} waits without limit.
+    template <ByteBuffer Buffer>
+    [[nodiscard]] auto read(Buffer &&buffer, TimeoutMs timeout = TimeoutMs{-1}) -> ReadAwaiter
+    {
+        return ReadAwaiter{*this, detail::async::writableBytes(buffer), timeout};
+    }
+
+    /**
+     * Read through the first occurrence of @p sequence (NUL-terminated, as for serialReadUntilSequence())
+     * without consuming anything after it: pending bytes are peeked, searched, and only the prefix up to the
+     * terminator is read. Returns the byte count including the terminator, the bytes read so far on timeout,
+     * or Io::kBufferError when @p buffer fills up first. @p buffer and @p sequence must outlive the task.
+     */
+    template <ByteBuffer Buffer>
+    [[nodiscard]] auto readUntil(Buffer &&buffer, const char *sequence, TimeoutMs timeout = TimeoutMs{-1})
+        -> Task<Result<std::size_t>>
+    {
+        return readUntilBytes(detail::async::writableBytes(buffer), std::string_view{sequence}, timeout);
+    }
+
+    // Structured cancellation: the pending (or next) read on this port fails with Io::kAbortReadError.
+    auto cancel() -> Status
+    {
+        return context_.cancel(port_.handle());
+    }
+
+  private:
+    [[nodiscard]] auto readNow(std::span<std::byte> buffer) -> Result<std::size_t>
+    {
+        return port_.read(buffer, TimeoutMs{0}, Multiplier{0});
+    }
+
+    auto readUntilBytes(std::span<std::byte> buffer, std::string_view sequence, TimeoutMs timeout)
+        -> Task<Result<std::size_t>>
+    {
+        const auto terminator = std::as_bytes(std::span(sequence));
+        if (terminator.empty())
+        {
+            co_return std::size_t{0};
+        }
+        const auto deadline = timeout.get() < 0 ? IoContext::Clock::time_point::max()
+                                                : IoContext::Clock::now() + std::chrono::milliseconds{timeout.get()};
+        std::size_t filled = 0;
+        while (filled < buffer.size())
+        {
+            const auto window = buffer.subspan(filled);
+            auto peeked = port_.peek(window, TimeoutMs{0});
+            if (!peeked)
+            {
+                co_return forwardUnexpected(std::move(peeked));
+            }
+            if (*peeked == 0)
+            {
+                auto readable = co_await context_.readable(port_.handle(), remainingMs(deadline));
+                if (!readable)
+                {
+                    co_return forwardUnexpected(std::move(readable));
+                }
+                if (!*readable)
+                {
+                    co_return filled;
+                }
+                continue;
+            }
+            // Start early enough to catch a terminator split across two peeks.
+            const auto from = filled - std::min(filled, terminator.size() - 1);
+            const auto searched = std::span<const std::byte>(buffer).subspan(from, filled + *peeked - from);
+            const auto found = findSequence(searched, terminator);
+            const auto take = found == kNotFound ? *peeked : from + found + terminator.size() - filled;
+            auto consumed = port_.read(window.first(take), TimeoutMs{0}, Multiplier{0});
+            if (!consumed)
+            {
+                co_return forwardUnexpected(std::move(consumed));
+            }
+            filled += *consumed;
+            if (found != kNotFound && *consumed == take)
+            {
+                co_return filled;
+            }
+        }
+        co_return fail<std::size_t>(StatusCode::Io::kBufferError);
+    }
+
+    [[nodiscard]] static auto remainingMs(IoContext::Clock::time_point deadline) -> TimeoutMs
+    {
+        if (deadline == IoContext::Clock::time_point::max())
+        {
+            return TimeoutMs{-1};
+        }
+        const auto remaining =
+            std::chrono::ceil<std::chrono::milliseconds>(deadline - IoContext::Clock::now()).count();
+        return TimeoutMs{static_cast<int>(std::clamp<std::int64_t>(remaining, 0, INT_MAX))};
+    }
+
+    IoContext &context_;
+    SerialPort &port_;
+};
+
+/**
+ * Frames completed by @p chunk, in order; a frame split across chunks is carried in @p decoder and
+ * yielded from the chunk that completes it. Malformed frames are skipped (the decoder resynchronises).
+ * Each yielded span aliases @p frame and is valid until the next step.
+ */
+template <FrameDecoder Decoder>
+auto decodedFrames(Decoder &decoder, std::span<const std::byte> chunk, std::span<std::byte> frame)
+    -> std::generator<std::span<const std::byte>>
+{
+    while (!chunk.empty())
+    {
+        const auto step = decoder.decode(chunk, frame);
+        chunk = chunk.subspan(step.consumed);
+        if (step.status == FrameStatus::kFrame)
+        {
+            co_yield std::span<const std::byte>(frame.first(decoder.frameSize()));
+        }
+    }
+}
+
+} // namespace cpp_core
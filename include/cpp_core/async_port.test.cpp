@@ -0,0 +1,50 @@
+#include "cpp_core/async_port.hpp"
+#include "cpp_core/cobs.hpp"
+#include "cpp_core/slip.hpp"
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cpp_core::tests::async_port
+{
+
+static_assert(FrameDecoder<CobsDecoder>);
+static_assert(FrameDecoder<SlipDecoder>);
+static_assert(!FrameDecoder<CobsEncoder>);
+
+static_assert(!std::is_copy_constructible_v<Task<int>>);
+static_assert(std::is_nothrow_move_constructible_v<Task<int>>);
+static_assert(std::is_nothrow_move_assignable_v<Task<>>);
+static_assert(!std::is_copy_constructible_v<IoContext>);
+
+template <typename Awaitable>
+using AwaitResult = decltype(std::declval<Awaitable>().operator co_await().await_resume());
+
+// co_await yields the task's value, so Result-returning tasks compose with forwardUnexpected().
+static_assert(std::is_same_v<AwaitResult<Task<Result<int>>>, Result<int>>);
+static_assert(std::is_same_v<AwaitResult<Task<>>, void>);
+
+using Read = decltype(std::declval<AsyncPort &>().read(std::declval<std::array<std::byte, 8> &>()));
+static_assert(std::is_same_v<decltype(std::declval<Read &>().await_resume()), Result<std::size_t>>);
+static_assert(std::is_same_v<decltype(std::declval<AsyncPort &>().readUntil(std::declval<std::vector<std::byte> &>(),
+                                                                            "\r\n")),
+                             Task<Result<std::size_t>>>);
+static_assert(std::is_same_v<decltype(std::declval<IoContext::ReadableAwaiter &>().await_resume()), Result<bool>>);
+
+// clang-format off
+template <typename Buffer>
+concept AsyncReadable = requires(AsyncPort &port, Buffer buffer) { port.read(buffer); };
+// clang-format on
+
+static_assert(AsyncReadable<std::span<std::byte>>);
+static_assert(!AsyncReadable<std::span<const std::byte>>);
+
+using Frames = decltype(decodedFrames(std::declval<CobsDecoder &>(), std::span<const std::byte>{},
+                                      std::span<std::byte>{}));
+static_assert(std::is_same_v<Frames, std::generator<std::span<const std::byte>>>);
+
+} // namespace cpp_core::tests::async_port
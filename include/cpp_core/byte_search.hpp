@@ -0,0 +1,339 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <span>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CPP_CORE_BYTE_SEARCH_X86 1
+#include <immintrin.h>
+#else
+#define CPP_CORE_BYTE_SEARCH_X86 0
+#endif
+
+namespace cpp_core
+{
+
+// Returned by findByte() / findSequence() when there is no match.
+inline constexpr std::size_t kNotFound = std::numeric_limits<std::size_t>::max();
+
+// Instruction-set tier used by the search kernels. Higher tiers are only used when the CPU supports them.
+enum class SearchLevel : int
+{
+    kScalar = 0,
+    kSse2 = 1,
+    kAvx2 = 2,
+    kAvx512 = 3,
+};
+
+namespace detail::byte_search
+{
+
+using FindByteFn = std::size_t (*)(const std::byte *, std::size_t, std::byte) noexcept;
+using FindSequenceFn = std::size_t (*)(const std::byte *, std::size_t, const std::byte *, std::size_t) noexcept;
+
+constexpr auto findByteScalar(const std::byte *data, std::size_t size, std::byte value) noexcept -> std::size_t
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        if (data[i] == value)
+        {
+            return i;
+        }
+    }
+    return kNotFound;
+}
+
+// Callers guarantee 2 <= sequence_size <= size.
+constexpr auto findSequenceScalarFrom(const std::byte *data, std::size_t size, const std::byte *sequence,
+                                      std::size_t sequence_size, std::size_t from) noexcept -> std::size_t
+{
+    for (std::size_t i = from; i + sequence_size <= size; ++i)
+    {
+        if (data[i] == sequence[0] && data[i + sequence_size - 1] == sequence[sequence_size - 1]
+            && std::equal(sequence + 1, sequence + sequence_size - 1, data + i + 1))
+        {
+            return i;
+        }
+    }
+    return kNotFound;
+}
+
+constexpr auto findSequenceScalar(const std::byte *data, std::size_t size, const std::byte *sequence,
+                                  std::size_t sequence_size) noexcept -> std::size_t
+{
+    return findSequenceScalarFrom(data, size, sequence, sequence_size, 0);
+}
+
+inline auto middleMatches(const std::byte *candidate, const std::byte *sequence, std::size_t sequence_size) noexcept
+    -> bool
+{
+    return sequence_size <= 2 || std::memcmp(candidate + 1, sequence + 1, sequence_size - 2) == 0;
+}
+
+#if CPP_CORE_BYTE_SEARCH_X86
+
+// Every kernel follows the same shape: compare full vector blocks, then hand the tail to the scalar loop.
+// Sequence kernels use the first/last-byte filter: a block position is a candidate only if both the first
+// and the last byte of the sequence match at their offsets; the middle is then verified with memcmp.
+
+inline auto findByteSse2(const std::byte *data, std::size_t size, std::byte value) noexcept -> std::size_t
+{
+    const __m128i needle = _mm_set1_epi8(static_cast<char>(value));
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+        const auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)));
+        if (mask != 0)
+        {
+            return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+    const auto tail = findByteScalar(data + i, size - i, value);
+    return tail == kNotFound ? kNotFound : i + tail;
+}
+
+inline auto findSequenceSse2(const std::byte *data, std::size_t size, const std::byte *sequence,
+                             std::size_t sequence_size) noexcept -> std::size_t
+{
+    const __m128i first = _mm_set1_epi8(static_cast<char>(sequence[0]));
+    const __m128i last = _mm_set1_epi8(static_cast<char>(sequence[sequence_size - 1]));
+    std::size_t i = 0;
+    for (; i + sequence_size - 1 + 16 <= size; i += 16)
+    {
+        const __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+        const __m128i block_last = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i + sequence_size - 1));
+        auto mask = static_cast<unsigned>(
+            _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, block_first), _mm_cmpeq_epi8(last, block_last))));
+        while (mask != 0)
+        {
+            const auto bit = static_cast<std::size_t>(std::countr_zero(mask));
+            if (middleMatches(data + i + bit, sequence, sequence_size))
+            {
+                return i + bit;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return findSequenceScalarFrom(data, size, sequence, sequence_size, i);
+}
+
+__attribute__((target("avx2"))) inline auto findByteAvx2(const std::byte *data, std::size_t size,
+                                                         std::byte value) noexcept -> std::size_t
+{
+    const __m256i needle = _mm256_set1_epi8(static_cast<char>(value));
+    std::size_t i = 0;
+    for (; i + 32 <= size; i += 32)
+    {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+        const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle)));
+        if (mask != 0)
+        {
+            return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+    const auto tail = findByteSse2(data + i, size - i, value);
+    return tail == kNotFound ? kNotFound : i + tail;
+}
+
+__attribute__((target("avx2"))) inline auto findSequenceAvx2(const std::byte *data, std::size_t size,
+                                                             const std::byte *sequence,
+                                                             std::size_t sequence_size) noexcept -> std::size_t
+{
+    const __m256i first = _mm256_set1_epi8(static_cast<char>(sequence[0]));
+    const __m256i last = _mm256_set1_epi8(static_cast<char>(sequence[sequence_size - 1]));
+    std::size_t i = 0;
+    for (; i + sequence_size - 1 + 32 <= size; i += 32)
+    {
+        const __m256i block_first = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+        const __m256i block_last =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i + sequence_size - 1));
+        auto mask = static_cast<unsigned>(_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(first, block_first), _mm256_cmpeq_epi8(last, block_last))));
+        while (mask != 0)
+        {
+            const auto bit = static_cast<std::size_t>(std::countr_zero(mask));
+            if (middleMatches(data + i + bit, sequence, sequence_size))
+            {
+                return i + bit;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return findSequenceScalarFrom(data, size, sequence, sequence_size, i);
+}
+
+__attribute__((target("avx512f,avx512bw"))) inline auto findByteAvx512(const std::byte *data, std::size_t size,
+                                                                       std::byte value) noexcept -> std::size_t
+{
+    const __m512i needle = _mm512_set1_epi8(static_cast<char>(value));
+    std::size_t i = 0;
+    for (; i + 64 <= size; i += 64)
+    {
+        const __m512i block = _mm512_loadu_si512(data + i);
+        const auto mask = static_cast<unsigned long long>(_mm512_cmpeq_epi8_mask(block, needle));
+        if (mask != 0)
+        {
+            return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+    const auto tail = findByteSse2(data + i, size - i, value);
+    return tail == kNotFound ? kNotFound : i + tail;
+}
+
+__attribute__((target("avx512f,avx512bw"))) inline auto findSequenceAvx512(const std::byte *data, std::size_t size,
+                                                                           const std::byte *sequence,
+                                                                           std::size_t sequence_size) noexcept
+    -> std::size_t
+{
+    const __m512i first = _mm512_set1_epi8(static_cast<char>(sequence[0]));
+    const __m512i last = _mm512_set1_epi8(static_cast<char>(sequence[sequence_size - 1]));
+    std::size_t i = 0;
+    for (; i + sequence_size - 1 + 64 <= size; i += 64)
+    {
+        const __m512i block_first = _mm512_loadu_si512(data + i);
+        const __m512i block_last = _mm512_loadu_si512(data + i + sequence_size - 1);
+        auto mask = static_cast<unsigned long long>(_mm512_cmpeq_epi8_mask(first, block_first)
+                                                    & _mm512_cmpeq_epi8_mask(last, block_last));
+        while (mask != 0)
+        {
+            const auto bit = static_cast<std::size_t>(std::countr_zero(mask));
+            if (middleMatches(data + i + bit, sequence, sequence_size))
+            {
+                return i + bit;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return findSequenceScalarFrom(data, size, sequence, sequence_size, i);
+}
+
+#endif // CPP_CORE_BYTE_SEARCH_X86
+
+struct Kernels
+{
+    FindByteFn find_byte;
+    FindSequenceFn find_sequence;
+};
+
+inline auto kernelsFor(SearchLevel level) noexcept -> Kernels
+{
+    switch (level)
+    {
+#if CPP_CORE_BYTE_SEARCH_X86
+    case SearchLevel::kAvx512:
+        return {findByteAvx512, findSequenceAvx512};
+    case SearchLevel::kAvx2:
+        return {findByteAvx2, findSequenceAvx2};
+    case SearchLevel::kSse2:
+        return {findByteSse2, findSequenceSse2};
+#endif
+    default:
+        return {findByteScalar, findSequenceScalar};
+    }
+}
+
+inline auto detectLevel() noexcept -> SearchLevel
+{
+#if CPP_CORE_BYTE_SEARCH_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    {
+        return SearchLevel::kAvx512;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return SearchLevel::kAvx2;
+    }
+    return SearchLevel::kSse2;
+#else
+    return SearchLevel::kScalar;
+#endif
+}
+
+// Resolved once per process on first use.
+inline auto activeKernels() noexcept -> const Kernels &
+{
+    static const Kernels kernels = kernelsFor(detectLevel());
+    return kernels;
+}
+
+} // namespace detail::byte_search
+
+// Best SearchLevel the running CPU supports; findByte() / findSequence() dispatch to it.
+[[nodiscard]] inline auto supportedSearchLevel() noexcept -> SearchLevel
+{
+    static const SearchLevel level = detail::byte_search::detectLevel();
+    return level;
+}
+
+/**
+ * Position of the first @p value in @p data, or kNotFound.
+ * Hot path of serialReadUntil() / serialReadLine(). Constant evaluation uses the scalar kernel,
+ * runtime calls the widest kernel the CPU supports.
+ */
+[[nodiscard]] constexpr auto findByte(std::span<const std::byte> data, std::byte value) noexcept -> std::size_t
+{
+    if consteval
+    {
+        return detail::byte_search::findByteScalar(data.data(), data.size(), value);
+    }
+    else
+    {
+        return detail::byte_search::activeKernels().find_byte(data.data(), data.size(), value);
+    }
+}
+
+/**
+ * Position of the first occurrence of @p sequence in @p data, or kNotFound (also for an empty sequence).
+ * Hot path of serialReadUntilSequence().
+ */
+[[nodiscard]] constexpr auto findSequence(std::span<const std::byte> data, std::span<const std::byte> sequence) noexcept
+    -> std::size_t
+{
+    if (sequence.empty() || sequence.size() > data.size())
+    {
+        return kNotFound;
+    }
+    if (sequence.size() == 1)
+    {
+        return findByte(data, sequence[0]);
+    }
+    if consteval
+    {
+        return detail::byte_search::findSequenceScalar(data.data(), data.size(), sequence.data(), sequence.size());
+    }
+    else
+    {
+        return detail::byte_search::activeKernels().find_sequence(data.data(), data.size(), sequence.data(),
+                                                                  sequence.size());
+    }
+}
+
+// Explicit-tier variants for tests and benchmarks. @p level must not exceed supportedSearchLevel().
+[[nodiscard]] inline auto findByte(std::span<const std::byte> data, std::byte value, SearchLevel level) noexcept
+    -> std::size_t
+{
+    return detail::byte_search::kernelsFor(level).find_byte(data.data(), data.size(), value);
+}
+
+[[nodiscard]] inline auto findSequence(std::span<const std::byte> data, std::span<const std::byte> sequence,
+                                       SearchLevel level) noexcept -> std::size_t
+{
+    if (sequence.empty() || sequence.size() > data.size())
+    {
+        return kNotFound;
+    }
+    if (sequence.size() == 1)
+    {
+        return findByte(data, sequence[0], level);
+    }
+    return detail::byte_search::kernelsFor(level).find_sequence(data.data(), data.size(), sequence.data(),
+                                                                sequence.size());
+}
+
+} // namespace cpp_core
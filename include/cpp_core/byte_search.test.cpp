@@ -0,0 +1,37 @@
+#include "cpp_core/byte_search.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace cpp_core::tests::byte_search
+{
+
+template <std::size_t N> consteval auto bytes(const char (&text)[N]) -> std::array<std::byte, N - 1>
+{
+    std::array<std::byte, N - 1> out{};
+    for (std::size_t i = 0; i + 1 < N; ++i)
+    {
+        out[i] = static_cast<std::byte>(text[i]);
+    }
+    return out;
+}
+
+constexpr auto kNmea = bytes("$GPGGA,123519,4807.038,N*47\r\n$GPGSA");
+constexpr auto kCrLf = bytes("\r\n");
+constexpr auto kOk = bytes("OK\r\n");
+
+static_assert(findByte(kNmea, std::byte{'\n'}) == 28);
+static_assert(findByte(kNmea, std::byte{'#'}) == kNotFound);
+static_assert(findByte(std::span<const std::byte>{}, std::byte{0}) == kNotFound);
+
+static_assert(findSequence(kNmea, kCrLf) == 27);
+static_assert(findSequence(kNmea, bytes("$GPGSA")) == 29);
+static_assert(findSequence(kNmea, bytes("*48")) == kNotFound);
+static_assert(findSequence(kNmea, std::span<const std::byte>{}) == kNotFound);
+static_assert(findSequence(kCrLf, kOk) == kNotFound);
+static_assert(findSequence(kOk, kOk) == 0);
+
+// Partial matches of the first and last byte must not be reported.
+static_assert(findSequence(bytes("ABxBABCB"), bytes("ABCB")) == 4);
+
+} // namespace cpp_core::tests::byte_search
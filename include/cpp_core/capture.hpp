@@ -0,0 +1,306 @@
+#pragma once
+
+#include "result.hpp"
+#include "serial_config.hpp"
+#include "status_code.h"
+#include "strong_types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+
+/*
+ * Serial traffic capture file, written by bindings through Recorder and read back by Reader.
+ *
+ *   FileHeader                 24 bytes: magic "CPPCAP\r\n", version, header size, wall-clock start
+ *   RecordHeader + payload     16 bytes + RecordHeader::size bytes, repeated until the end of the file
+ *
+ * Record timestamps are steady-clock nanoseconds since the recorder started, so they never jump with the
+ * wall clock; FileHeader::wall_start_ns ties them to log timestamps. Records are unpadded and in the
+ * order they were written. A capture cut short mid-record (crash, full disk) stays readable up to its
+ * last complete record. All fields are little-endian.
+ */
+
+namespace cpp_core::capture
+{
+
+static_assert(std::endian::native == std::endian::little, "Capture files are written in native byte order");
+
+using Clock = std::chrono::steady_clock;
+
+inline constexpr std::array<char, 8> kMagic{'C', 'P', 'P', 'C', 'A', 'P', '\r', '\n'};
+inline constexpr std::uint32_t kVersion = 1;
+
+enum class RecordKind : std::uint8_t
+{
+    kData = 1,   // payload: the bytes
+    kLines = 2,  // payload: one byte of LineBit flags, the full modem-line state after the change
+    kConfig = 3, // payload: baudrate, data_bits, parity, stop_bits, flow_control as int32
+    kBreak = 4,  // payload: duration in ms as int32
+};
+
+enum class Direction : std::uint8_t
+{
+    kRx = 0, // device to host
+    kTx = 1, // host to device
+};
+
+enum class LineBit : std::uint8_t
+{
+    kDtr = 1 << 0,
+    kRts = 1 << 1,
+    kCts = 1 << 2,
+    kDsr = 1 << 3,
+    kDcd = 1 << 4,
+    kRi = 1 << 5,
+};
+
+struct FileHeader
+{
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t header_size; // offset of the first record; readers skip fields they do not know
+    std::int64_t wall_start_ns; // system_clock time of timestamp 0
+};
+
+struct RecordHeader
+{
+    std::int64_t timestamp_ns;
+    std::uint32_t size;
+    RecordKind kind;
+    Direction direction;
+    std::uint16_t reserved;
+};
+
+static_assert(sizeof(FileHeader) == 24 && sizeof(RecordHeader) == 16);
+
+inline constexpr std::size_t kConfigPayloadSize = 5 * sizeof(std::int32_t);
+
+[[nodiscard]] constexpr auto lineMask(bool dtr, bool rts, bool cts, bool dsr, bool dcd, bool ri) noexcept
+    -> std::uint8_t
+{
+    return static_cast<std::uint8_t>((dtr ? toInt(LineBit::kDtr) : 0) | (rts ? toInt(LineBit::kRts) : 0)
+                                     | (cts ? toInt(LineBit::kCts) : 0) | (dsr ? toInt(LineBit::kDsr) : 0)
+                                     | (dcd ? toInt(LineBit::kDcd) : 0) | (ri ? toInt(LineBit::kRi) : 0));
+}
+
+[[nodiscard]] constexpr auto hasLine(std::uint8_t mask, LineBit line) noexcept -> bool
+{
+    return (mask & toInt(line)) != 0;
+}
+
+// One record as stored in the file; `payload` points into the buffer the Reader was given.
+struct Record
+{
+    std::int64_t timestamp_ns;
+    RecordKind kind;
+    Direction direction;
+    std::span<const std::byte> payload;
+
+    // LineBit flags of a kLines record.
+    [[nodiscard]] auto lines() const noexcept -> std::uint8_t
+    {
+        return payload.empty() ? 0 : std::to_integer<std::uint8_t>(payload.front());
+    }
+
+    // Duration of a kBreak record.
+    [[nodiscard]] auto breakMs() const noexcept -> int
+    {
+        std::int32_t value = 0;
+        std::memcpy(&value, payload.data(), std::min(payload.size(), sizeof value));
+        return value;
+    }
+
+    // Line settings of a kConfig record; timeouts are not captured and read back as 0.
+    [[nodiscard]] auto config() const -> Result<SerialConfig>
+    {
+        std::array<std::int32_t, 5> fields{};
+        if (payload.size() < kConfigPayloadSize)
+        {
+            return fail<SerialConfig>(StatusCode::Io::kReadError, "Short config record");
+        }
+        std::memcpy(fields.data(), payload.data(), kConfigPayloadSize);
+        return SerialConfig::tryMake(fields[0], fields[1], static_cast<Parity>(fields[2]),
+                                     static_cast<StopBits>(fields[3]), static_cast<FlowControl>(fields[4]));
+    }
+};
+
+/**
+ * Appends records to a capture file. Bindings tee into it from their read, write, line and configure
+ * paths; every call is thread-safe and goes through a 1 MiB stdio buffer, so a record costs a memcpy
+ * and the disk is written in large blocks. A failed write is remembered and reported by close().
+ *   auto recorder = capture::Recorder::tryOpen("field.cap");
+ *   (*recorder)->data(capture::Direction::kRx, received);
+ */
+class Recorder
+{
+  public:
+    static constexpr std::size_t kBufferSize = std::size_t{1} << 20;
+
+    [[nodiscard]] static auto tryOpen(const char *path) -> Result<std::unique_ptr<Recorder>>
+    {
+        File file(std::fopen(path, "wb"), &std::fclose);
+        if (!file)
+        {
+            return fail<std::unique_ptr<Recorder>>(StatusCode::Io::kWriteError, "Cannot create capture file");
+        }
+        auto recorder = std::unique_ptr<Recorder>(new Recorder(std::move(file)));
+        const auto wall = std::chrono::system_clock::now().time_since_epoch();
+        const FileHeader header{kMagic, kVersion, sizeof(FileHeader),
+                                std::chrono::duration_cast<std::chrono::nanoseconds>(wall).count()};
+        recorder->put(&header, sizeof header);
+        return recorder;
+    }
+
+    Recorder(const Recorder &) = delete;
+    auto operator=(const Recorder &) -> Recorder & = delete;
+    ~Recorder() = default;
+
+    auto data(Direction direction, std::span<const std::byte> bytes, Clock::time_point at = Clock::now()) -> void
+    {
+        // RecordHeader::size is 32 bits; larger chunks become several records with the same timestamp.
+        // An empty span writes nothing.
+        constexpr std::size_t kMaxChunk = std::size_t{1} << 30;
+        while (!bytes.empty())
+        {
+            const auto chunk = bytes.first(std::min(bytes.size(), kMaxChunk));
+            append(RecordKind::kData, direction, at, chunk);
+            bytes = bytes.subspan(chunk.size());
+        }
+    }
+
+    auto lines(std::uint8_t mask, Clock::time_point at = Clock::now()) -> void
+    {
+        const std::array<std::byte, 1> payload{std::byte{mask}};
+        append(RecordKind::kLines, Direction::kRx, at, payload);
+    }
+
+    auto config(const SerialConfig &config, Clock::time_point at = Clock::now()) -> void
+    {
+        const std::array<std::int32_t, 5> fields{config.baudrate, config.data_bits, config.parityInt(),
+                                                 config.stopBitsInt(), config.flowControlInt()};
+        append(RecordKind::kConfig, Direction::kTx, at, std::as_bytes(std::span(fields)));
+    }
+
+    auto lineBreak(Direction direction, int duration_ms, Clock::time_point at = Clock::now()) -> void
+    {
+        const std::int32_t value = duration_ms;
+        append(RecordKind::kBreak, direction, at, std::as_bytes(std::span(&value, 1)));
+    }
+
+    // Flush and close the file; later records are ignored. Reports the first write that failed.
+    [[nodiscard]] auto close() -> Status
+    {
+        const std::scoped_lock lock(mutex_);
+        if (file_)
+        {
+            failed_ = std::fclose(file_.release()) != 0 || failed_;
+        }
+        if (failed_)
+        {
+            return fail(StatusCode::Io::kWriteError, "Capture file write failed");
+        }
+        return ok();
+    }
+
+  private:
+    using File = std::unique_ptr<std::FILE, decltype(&std::fclose)>;
+
+    explicit Recorder(File file) : file_(std::move(file))
+    {
+        std::setvbuf(file_.get(), nullptr, _IOFBF, kBufferSize);
+    }
+
+    auto append(RecordKind kind, Direction direction, Clock::time_point at, std::span<const std::byte> payload)
+        -> void
+    {
+        const RecordHeader header{std::chrono::duration_cast<std::chrono::nanoseconds>(at - origin_).count(),
+                                  static_cast<std::uint32_t>(payload.size()), kind, direction, 0};
+        const std::scoped_lock lock(mutex_);
+        put(&header, sizeof header);
+        put(payload.data(), payload.size());
+    }
+
+    auto put(const void *data, std::size_t size) -> void
+    {
+        if (file_ && size != 0 && std::fwrite(data, 1, size, file_.get()) != size)
+        {
+            failed_ = true;
+        }
+    }
+
+    std::mutex mutex_;
+    File file_;
+    Clock::time_point origin_ = Clock::now();
+    bool failed_ = false;
+};
+
+/**
+ * Walks the records of a capture held in memory, typically a read-only mapping of the file. Nothing is
+ * copied: each Record's payload is a view into @p file, valid as long as the mapping is.
+ *   auto reader = capture::Reader::tryMake(mapped);
+ *   while (const auto record = reader->next()) { ... }
+ */
+class Reader
+{
+  public:
+    [[nodiscard]] static auto tryMake(std::span<const std::byte> file) -> Result<Reader>
+    {
+        FileHeader header{};
+        if (file.size() < sizeof header)
+        {
+            return fail<Reader>(StatusCode::Io::kReadError, "Not a capture file");
+        }
+        std::memcpy(&header, file.data(), sizeof header);
+        if (header.magic != kMagic || header.version != kVersion || header.header_size < sizeof header
+            || header.header_size > file.size())
+        {
+            return fail<Reader>(StatusCode::Io::kReadError, "Not a capture file");
+        }
+        return Reader(file, header);
+    }
+
+    [[nodiscard]] auto header() const noexcept -> const FileHeader &
+    {
+        return header_;
+    }
+
+    // The next complete record, or nullopt at the end of the capture.
+    [[nodiscard]] auto next() noexcept -> std::optional<Record>
+    {
+        RecordHeader header{};
+        if (file_.size() - offset_ < sizeof header)
+        {
+            return std::nullopt;
+        }
+        std::memcpy(&header, file_.data() + offset_, sizeof header);
+        if (file_.size() - offset_ - sizeof header < header.size)
+        {
+            return std::nullopt;
+        }
+        const auto payload = file_.subspan(offset_ + sizeof header, header.size);
+        offset_ += sizeof header + header.size;
+        return Record{header.timestamp_ns, header.kind, header.direction, payload};
+    }
+
+  private:
+    Reader(std::span<const std::byte> file, const FileHeader &header)
+        : file_(file), header_(header), offset_(header.header_size)
+    {
+    }
+
+    std::span<const std::byte> file_;
+    FileHeader header_;
+    std::size_t offset_;
+};
+
+} // namespace cpp_core::capture
@@ -0,0 +1,24 @@
+#include "cpp_core/capture.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace cpp_core::tests::capture
+{
+
+using namespace cpp_core::capture;
+
+// Headers are copied in and out of the file with memcpy.
+static_assert(std::is_trivially_copyable_v<FileHeader> && std::is_trivially_copyable_v<RecordHeader>);
+static_assert(sizeof(FileHeader) == 24 && sizeof(RecordHeader) == 16);
+static_assert(kMagic.size() == 8 && kMagic[6] == '\r' && kMagic[7] == '\n');
+
+static_assert(lineMask(false, false, false, false, false, false) == 0);
+static_assert(lineMask(true, true, true, true, true, true) == 0x3F);
+static_assert(hasLine(lineMask(false, false, true, false, false, false), LineBit::kCts));
+static_assert(!hasLine(lineMask(true, true, false, true, true, true), LineBit::kCts));
+static_assert(hasLine(lineMask(false, false, false, false, false, true), LineBit::kRi));
+
+static_assert(kConfigPayloadSize == 5 * sizeof(std::int32_t));
+
+} // namespace cpp_core::tests::capture
@@ -0,0 +1,241 @@
+#pragma once
+
+#include "byte_search.hpp"
+#include "framing.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+
+namespace cpp_core
+{
+
+namespace detail::cobs
+{
+
+inline constexpr std::byte kDelimiter{0x00};
+inline constexpr std::size_t kMaxBlock = 254;
+
+// Writes code byte + block, returns bytes written. @p zero_terminated: the block is followed by a zero in the input.
+constexpr auto emitBlock(std::span<std::byte> out, std::span<const std::byte> block, bool zero_terminated) noexcept
+    -> std::size_t
+{
+    out[0] = zero_terminated ? static_cast<std::byte>(block.size() + 1) : std::byte{0xFF};
+    std::copy(block.begin(), block.end(), out.begin() + 1);
+    return block.size() + 1;
+}
+
+} // namespace detail::cobs
+
+// Worst-case encoded size of a @p size byte frame, including the trailing 0x00 delimiter.
+[[nodiscard]] constexpr auto cobsMaxEncodedSize(std::size_t size) noexcept -> std::size_t
+{
+    return size + (size / detail::cobs::kMaxBlock) + 2;
+}
+
+/**
+ * Streaming COBS encoder (Consistent Overhead Byte Stuffing, 0x00 delimiter).
+ * A frame may be fed in any number of chunks (e.g. header, payload, CRC); zero-free runs are copied
+ * in bulk and at most one partial block (254 bytes) is staged between calls.
+ *   encoder.encode(header, out);  encoder.encode(payload, out...);  encoder.finish(out...);
+ */
+class CobsEncoder
+{
+  public:
+    // Output space encode() needs for @p input_size more bytes, including the block staged by earlier calls.
+    [[nodiscard]] constexpr auto encodeBound(std::size_t input_size) const noexcept -> std::size_t
+    {
+        const auto total = block_size_ + input_size;
+        return total + (total / detail::cobs::kMaxBlock);
+    }
+
+    // Output space finish() needs.
+    [[nodiscard]] constexpr auto finishBound() const noexcept -> std::size_t
+    {
+        return block_size_ + 2;
+    }
+
+    // Encode the next part of the frame. Consumes nothing if output.size() < encodeBound(input.size()).
+    constexpr auto encode(std::span<const std::byte> input, std::span<std::byte> output) noexcept -> CodecProgress
+    {
+        using detail::cobs::kMaxBlock;
+        if (output.size() < encodeBound(input.size()))
+        {
+            return {.consumed = 0, .produced = 0};
+        }
+        std::size_t in = 0;
+        std::size_t out = 0;
+        while (in < input.size())
+        {
+            const auto window = input.subspan(in, std::min(kMaxBlock - block_size_, input.size() - in));
+            const auto zero = findByte(window, detail::cobs::kDelimiter);
+            const bool zero_terminated = zero != kNotFound;
+            const auto run = window.first(zero_terminated ? zero : window.size());
+            const bool block_complete = zero_terminated || block_size_ + run.size() == kMaxBlock;
+            if (block_complete && block_size_ == 0)
+            {
+                // The whole block is in the input: emit it without staging.
+                out += detail::cobs::emitBlock(output.subspan(out), run, zero_terminated);
+            }
+            else
+            {
+                std::copy(run.begin(), run.end(), block_.begin() + static_cast<std::ptrdiff_t>(block_size_));
+                block_size_ += run.size();
+                if (block_complete)
+                {
+                    out += detail::cobs::emitBlock(output.subspan(out), std::span(block_).first(block_size_),
+                                                   zero_terminated);
+                    block_size_ = 0;
+                }
+            }
+            if (block_complete)
+            {
+                after_full_block_ = !zero_terminated;
+            }
+            in += run.size() + (zero_terminated ? 1 : 0);
+        }
+        return {.consumed = in, .produced = out};
+    }
+
+    // Flush the staged block and append the delimiter. Writes nothing if output.size() < finishBound().
+    constexpr auto finish(std::span<std::byte> output) noexcept -> CodecProgress
+    {
+        if (output.size() < finishBound())
+        {
+            return {.consumed = 0, .produced = 0};
+        }
+        std::size_t out = 0;
+        // A frame that ends right after a full 0xFF block needs no extra empty block.
+        if (block_size_ != 0 || !after_full_block_)
+        {
+            out = detail::cobs::emitBlock(output, std::span(block_).first(block_size_), true);
+        }
+        output[out++] = detail::cobs::kDelimiter;
+        reset();
+        return {.consumed = 0, .produced = out};
+    }
+
+    constexpr auto reset() noexcept -> void
+    {
+        block_size_ = 0;
+        after_full_block_ = false;
+    }
+
+  private:
+    std::array<std::byte, detail::cobs::kMaxBlock> block_{};
+    std::size_t block_size_{0};
+    bool after_full_block_{false};
+};
+
+/**
+ * Streaming COBS decoder. Feed received chunks as they arrive; frames may span chunk boundaries.
+ * Data runs are located with findByte() and copied in bulk. See FrameProgress for the call loop.
+ */
+class CobsDecoder
+{
+  public:
+    // Size of the frame reported by the last kFrame result.
+    [[nodiscard]] constexpr auto frameSize() const noexcept -> std::size_t
+    {
+        return frame_size_;
+    }
+
+    constexpr auto decode(std::span<const std::byte> input, std::span<std::byte> frame) noexcept -> FrameProgress
+    {
+        if (frame_done_)
+        {
+            resetFrame();
+        }
+        std::size_t in = 0;
+        while (in < input.size())
+        {
+            if (discarding_)
+            {
+                const auto delimiter = findByte(input.subspan(in), detail::cobs::kDelimiter);
+                if (delimiter == kNotFound)
+                {
+                    return {.status = FrameStatus::kNeedMore, .consumed = input.size()};
+                }
+                in += delimiter + 1;
+                resetFrame();
+                continue;
+            }
+            if (remaining_ == 0)
+            {
+                const auto code = static_cast<std::size_t>(input[in++]);
+                if (code == 0)
+                {
+                    if (!started_)
+                    {
+                        continue; // Idle delimiter between frames.
+                    }
+                    frame_done_ = true;
+                    return {.status = FrameStatus::kFrame, .consumed = in};
+                }
+                if (pending_zero_)
+                {
+                    if (frame_size_ == frame.size())
+                    {
+                        return fail(in);
+                    }
+                    frame[frame_size_++] = detail::cobs::kDelimiter;
+                }
+                started_ = true;
+                remaining_ = code - 1;
+                pending_zero_ = code != 0xFF;
+                continue;
+            }
+            const auto window = input.subspan(in, std::min(remaining_, input.size() - in));
+            const auto zero = findByte(window, detail::cobs::kDelimiter);
+            const auto run = window.first(zero == kNotFound ? window.size() : zero);
+            if (run.size() > frame.size() - frame_size_)
+            {
+                return fail(in);
+            }
+            std::copy(run.begin(), run.end(), frame.begin() + static_cast<std::ptrdiff_t>(frame_size_));
+            frame_size_ += run.size();
+            remaining_ -= run.size();
+            in += run.size();
+            if (zero != kNotFound)
+            {
+                // Delimiter inside a block: the frame was truncated. The delimiter already resynchronises.
+                resetFrame();
+                return {.status = FrameStatus::kError, .consumed = in + 1};
+            }
+        }
+        return {.status = FrameStatus::kNeedMore, .consumed = in};
+    }
+
+    constexpr auto reset() noexcept -> void
+    {
+        resetFrame();
+    }
+
+  private:
+    constexpr auto resetFrame() noexcept -> void
+    {
+        frame_size_ = 0;
+        remaining_ = 0;
+        pending_zero_ = false;
+        started_ = false;
+        discarding_ = false;
+        frame_done_ = false;
+    }
+
+    constexpr auto fail(std::size_t consumed) noexcept -> FrameProgress
+    {
+        resetFrame();
+        discarding_ = true;
+        return {.status = FrameStatus::kError, .consumed = consumed};
+    }
+
+    std::size_t frame_size_{0};
+    std::size_t remaining_{0};
+    bool pending_zero_{false};
+    bool started_{false};
+    bool discarding_{false};
+    bool frame_done_{false};
+};
+
+} // namespace cpp_core
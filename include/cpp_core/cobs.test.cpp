@@ -0,0 +1,164 @@
+#include "cpp_core/cobs.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+
+namespace cpp_core::tests::cobs
+{
+
+template <std::size_t N> constexpr auto bytes(const std::array<int, N> &values) -> std::array<std::byte, N>
+{
+    std::array<std::byte, N> out{};
+    std::ranges::transform(values, out.begin(), [](int value) { return static_cast<std::byte>(value); });
+    return out;
+}
+
+// Encode @p input fed in @p chunk sized pieces; compare against @p expected.
+template <std::size_t N, std::size_t M>
+constexpr auto encodesTo(const std::array<std::byte, N> &input, const std::array<std::byte, M> &expected,
+                         std::size_t chunk) -> bool
+{
+    CobsEncoder encoder;
+    std::array<std::byte, cobsMaxEncodedSize(N)> out{};
+    std::size_t produced = 0;
+    for (std::size_t offset = 0; offset < N; offset += chunk)
+    {
+        const auto part = std::span(input).subspan(offset, std::min(chunk, N - offset));
+        const auto step = encoder.encode(part, std::span(out).subspan(produced));
+        if (step.consumed != part.size())
+        {
+            return false;
+        }
+        produced += step.produced;
+    }
+    produced += encoder.finish(std::span(out).subspan(produced)).produced;
+    return produced == M && std::ranges::equal(std::span(out).first(M), expected);
+}
+
+// Decode @p encoded fed in @p chunk sized pieces; expect exactly one frame equal to @p expected.
+template <std::size_t N, std::size_t M>
+constexpr auto decodesTo(const std::array<std::byte, N> &encoded, const std::array<std::byte, M> &expected,
+                         std::size_t chunk) -> bool
+{
+    CobsDecoder decoder;
+    std::array<std::byte, M + 1> frame{};
+    int frames = 0;
+    bool match = false;
+    for (std::size_t offset = 0; offset < N; offset += chunk)
+    {
+        auto part = std::span(encoded).subspan(offset, std::min(chunk, N - offset));
+        while (!part.empty())
+        {
+            const auto step = decoder.decode(part, frame);
+            part = part.subspan(step.consumed);
+            if (step.status == FrameStatus::kFrame)
+            {
+                ++frames;
+                match = std::ranges::equal(std::span(frame).first(decoder.frameSize()), expected);
+            }
+        }
+    }
+    return frames == 1 && match;
+}
+
+template <std::size_t N, std::size_t M>
+constexpr auto roundTrips(const std::array<std::byte, N> &raw, const std::array<std::byte, M> &encoded) -> bool
+{
+    return encodesTo(raw, encoded, N == 0 ? 1 : N) && encodesTo(raw, encoded, 1) && encodesTo(raw, encoded, 7)
+           && decodesTo(encoded, raw, M) && decodesTo(encoded, raw, 1) && decodesTo(encoded, raw, 7);
+}
+
+// Bytes first, first + 1, ... for inputs longer than one block.
+template <std::size_t N> consteval auto sequence(int first) -> std::array<std::byte, N>
+{
+    std::array<std::byte, N> out{};
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        out[i] = static_cast<std::byte>(first + static_cast<int>(i));
+    }
+    return out;
+}
+
+consteval auto encodesShortVectors() -> bool
+{
+    return roundTrips(bytes<0>({}), bytes<2>({0x01, 0x00}))
+           && roundTrips(bytes<1>({0x00}), bytes<3>({0x01, 0x01, 0x00}))
+           && roundTrips(bytes<2>({0x00, 0x00}), bytes<4>({0x01, 0x01, 0x01, 0x00}))
+           && roundTrips(bytes<3>({0x00, 0x11, 0x00}), bytes<5>({0x01, 0x02, 0x11, 0x01, 0x00}))
+           && roundTrips(bytes<4>({0x11, 0x22, 0x00, 0x33}), bytes<6>({0x03, 0x11, 0x22, 0x02, 0x33, 0x00}))
+           && roundTrips(bytes<4>({0x11, 0x22, 0x33, 0x44}), bytes<6>({0x05, 0x11, 0x22, 0x33, 0x44, 0x00}))
+           && roundTrips(bytes<4>({0x11, 0x00, 0x00, 0x00}), bytes<6>({0x02, 0x11, 0x01, 0x01, 0x01, 0x00}));
+}
+
+// 254 non-zero bytes fill one 0xFF block with no trailing empty block.
+consteval auto encodesFullBlock() -> bool
+{
+    const auto raw = sequence<254>(1);
+    std::array<std::byte, 256> encoded{};
+    encoded[0] = std::byte{0xFF};
+    std::ranges::copy(raw, encoded.begin() + 1);
+    return roundTrips(raw, encoded);
+}
+
+// 01..FF: a full block followed by a two-byte block.
+consteval auto encodesBlockBoundary() -> bool
+{
+    const auto raw = sequence<255>(1);
+    std::array<std::byte, 258> encoded{};
+    encoded[0] = std::byte{0xFF};
+    std::ranges::copy(std::span(raw).first(254), encoded.begin() + 1);
+    encoded[255] = std::byte{0x02};
+    encoded[256] = std::byte{0xFF};
+    return roundTrips(raw, encoded);
+}
+
+consteval auto skipsIdleDelimitersAndSplitsFrames() -> bool
+{
+    const auto stream = bytes<9>({0x00, 0x00, 0x02, 0x11, 0x00, 0x03, 0x22, 0x33, 0x00});
+    CobsDecoder decoder;
+    std::array<std::byte, 4> frame{};
+    auto first = decoder.decode(stream, frame);
+    const bool first_ok = first.status == FrameStatus::kFrame && first.consumed == 5 && decoder.frameSize() == 1
+                          && frame[0] == std::byte{0x11};
+    auto second = decoder.decode(std::span(stream).subspan(first.consumed), frame);
+    return first_ok && second.status == FrameStatus::kFrame && decoder.frameSize() == 2 && frame[1] == std::byte{0x33};
+}
+
+consteval auto resynchronisesAfterErrors() -> bool
+{
+    // Truncated block (delimiter where data was expected), then an oversized frame, then a good one.
+    const auto stream = bytes<13>({0x05, 0x11, 0x00, 0x06, 0x01, 0x02, 0x03, 0x04, 0x05, 0x00, 0x02, 0x44, 0x00});
+    CobsDecoder decoder;
+    std::array<std::byte, 3> frame{};
+    std::span<const std::byte> rest = stream;
+    const auto truncated = decoder.decode(rest, frame);
+    rest = rest.subspan(truncated.consumed);
+    const auto oversized = decoder.decode(rest, frame);
+    rest = rest.subspan(oversized.consumed);
+    const auto good = decoder.decode(rest, frame);
+    return truncated.status == FrameStatus::kError && truncated.consumed == 3
+           && oversized.status == FrameStatus::kError && good.status == FrameStatus::kFrame
+           && decoder.frameSize() == 1 && frame[0] == std::byte{0x44};
+}
+
+consteval auto encoderRefusesShortOutput() -> bool
+{
+    CobsEncoder encoder;
+    const auto raw = bytes<3>({0x01, 0x00, 0x02});
+    std::array<std::byte, 2> out{};
+    const auto step = encoder.encode(raw, out);
+    return encoder.encodeBound(raw.size()) == 3 && step.consumed == 0 && step.produced == 0;
+}
+
+static_assert(cobsMaxEncodedSize(0) == 2);
+static_assert(cobsMaxEncodedSize(254) == 257);
+static_assert(encodesShortVectors());
+static_assert(encodesFullBlock());
+static_assert(encodesBlockBoundary());
+static_assert(skipsIdleDelimitersAndSplitsFrames());
+static_assert(resynchronisesAfterErrors());
+static_assert(encoderRefusesShortOutput());
+
+} // namespace cpp_core::tests::cobs
@@ -0,0 +1,419 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CPP_CORE_CRC_X86 1
+#include <immintrin.h>
+#else
+#define CPP_CORE_CRC_X86 0
+#endif
+
+namespace cpp_core
+{
+
+/**
+ * Rocksoft-model CRC parameter set, as listed in the "Catalogue of parametrised CRC algorithms".
+ * `check` is the CRC of the ASCII string "123456789"; make() verifies it at compile time.
+ *   constexpr auto kSpec = CrcSpec::make<16, 0x8005, 0xFFFF, true, true, 0x0000, 0x4B37>();
+ */
+struct CrcSpec
+{
+    int width;
+    std::uint64_t poly;
+    std::uint64_t init;
+    bool reflect_in;
+    bool reflect_out;
+    std::uint64_t xor_out;
+    std::uint64_t check;
+
+    template <int Width, std::uint64_t Poly, std::uint64_t Init, bool ReflectIn, bool ReflectOut, std::uint64_t XorOut,
+              std::uint64_t Check>
+    static consteval auto make() -> CrcSpec;
+};
+
+// Table-driven kernel used by Crc<>::update(). kClmul only applies to the CRC-32 polynomial.
+enum class CrcKernel : int
+{
+    kSlicingBy8 = 0,
+    kClmul = 1,
+};
+
+namespace detail::crc
+{
+
+constexpr auto widthMask(int width) noexcept -> std::uint64_t
+{
+    return width == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << width) - 1;
+}
+
+constexpr auto reflect(std::uint64_t value, int width) noexcept -> std::uint64_t
+{
+    std::uint64_t out = 0;
+    for (int bit = 0; bit < width; ++bit)
+    {
+        out = (out << 1) | ((value >> bit) & 1U);
+    }
+    return out;
+}
+
+// Bit-at-a-time reference implementation; only used to verify specs and tables.
+constexpr auto bitwise(const CrcSpec &spec, std::span<const std::byte> data) noexcept -> std::uint64_t
+{
+    const auto mask = widthMask(spec.width);
+    const auto top = std::uint64_t{1} << (spec.width - 1);
+    auto reg = spec.init;
+    for (const auto byte : data)
+    {
+        const auto value = static_cast<std::uint64_t>(byte);
+        reg ^= (spec.reflect_in ? reflect(value, 8) : value) << (spec.width - 8);
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            reg = ((reg & top) != 0 ? (reg << 1) ^ spec.poly : reg << 1) & mask;
+        }
+    }
+    return (spec.reflect_out ? reflect(reg, spec.width) : reg) ^ spec.xor_out;
+}
+
+inline constexpr std::array<std::byte, 9> kCheckInput{std::byte{'1'}, std::byte{'2'}, std::byte{'3'},
+                                                      std::byte{'4'}, std::byte{'5'}, std::byte{'6'},
+                                                      std::byte{'7'}, std::byte{'8'}, std::byte{'9'}};
+
+// Smallest unsigned type holding a CRC of @p Width bits; also the register type of the table kernel.
+template <int Width>
+using ValueFor =
+    std::conditional_t<(Width <= 8), std::uint8_t,
+                       std::conditional_t<(Width <= 16), std::uint16_t,
+                                          std::conditional_t<(Width <= 32), std::uint32_t, std::uint64_t>>>;
+
+template <typename Value> using Tables = std::array<std::array<Value, 256>, 8>;
+
+/**
+ * Slicing-by-8 tables: tables[k][b] is the register after byte b followed by k zero bytes.
+ * Reflected specs keep the register right-aligned, the others left-aligned in Value.
+ */
+template <typename Value> consteval auto makeTables(const CrcSpec &spec) -> Tables<Value>
+{
+    constexpr int kBits = 8 * sizeof(Value);
+    const auto mask = widthMask(kBits);
+    Tables<Value> tables{};
+    for (std::size_t byte = 0; byte < 256; ++byte)
+    {
+        std::uint64_t reg = 0;
+        if (spec.reflect_in)
+        {
+            const auto poly = reflect(spec.poly, spec.width);
+            reg = byte;
+            for (int bit = 0; bit < 8; ++bit)
+            {
+                reg = (reg & 1U) != 0 ? (reg >> 1) ^ poly : reg >> 1;
+            }
+        }
+        else
+        {
+            const auto poly = spec.poly << (kBits - spec.width);
+            const auto top = std::uint64_t{1} << (kBits - 1);
+            reg = static_cast<std::uint64_t>(byte) << (kBits - 8);
+            for (int bit = 0; bit < 8; ++bit)
+            {
+                reg = ((reg & top) != 0 ? (reg << 1) ^ poly : reg << 1) & mask;
+            }
+        }
+        tables[0][byte] = static_cast<Value>(reg);
+    }
+    for (std::size_t k = 1; k < tables.size(); ++k)
+    {
+        for (std::size_t byte = 0; byte < 256; ++byte)
+        {
+            const auto prev = static_cast<std::uint64_t>(tables[k - 1][byte]);
+            tables[k][byte] =
+                spec.reflect_in ? static_cast<Value>((prev >> 8) ^ tables[0][prev & 0xFFU])
+                                : static_cast<Value>(((prev << 8) & mask) ^ tables[0][prev >> (kBits - 8)]);
+        }
+    }
+    return tables;
+}
+
+constexpr auto loadLe64(const std::byte *data) noexcept -> std::uint64_t
+{
+    if !consteval
+    {
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            std::uint64_t value = 0;
+            std::memcpy(&value, data, sizeof(value));
+            return value;
+        }
+    }
+    std::uint64_t value = 0;
+    for (int i = 7; i >= 0; --i)
+    {
+        value = (value << 8) | static_cast<std::uint64_t>(data[i]);
+    }
+    return value;
+}
+
+constexpr auto loadBe64(const std::byte *data) noexcept -> std::uint64_t
+{
+    if !consteval
+    {
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            return std::byteswap(loadLe64(data));
+        }
+    }
+    std::uint64_t value = 0;
+    for (int i = 0; i < 8; ++i)
+    {
+        value = (value << 8) | static_cast<std::uint64_t>(data[i]);
+    }
+    return value;
+}
+
+inline constexpr std::uint64_t kCrc32Poly = 0x04C11DB7;
+
+// The carry-less multiply kernel needs at least four 16-byte lanes.
+inline constexpr std::size_t kClmulMinSize = 64;
+
+#if CPP_CORE_CRC_X86
+// acc * x^k (both 64-bit halves) + next: one 128-bit folding step.
+__attribute__((target("pclmul,sse4.1"))) inline auto clmulFold(__m128i acc, __m128i keys, __m128i next) noexcept
+    -> __m128i
+{
+    return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(acc, keys, 0x11), _mm_clmulepi64_si128(acc, keys, 0x00)),
+                         next);
+}
+
+/**
+ * Folds @p size bytes (multiple of 16, >= kClmulMinSize) into the reflected CRC-32 register @p reg with
+ * PCLMULQDQ, then Barrett-reduces back to 32 bits. Constants are x^n mod P for the 0x04C11DB7 polynomial
+ * (Intel, "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ").
+ */
+__attribute__((target("pclmul,sse4.1"))) inline auto crc32Clmul(std::uint32_t reg, const std::byte *data,
+                                                                 std::size_t size) noexcept -> std::uint32_t
+{
+    alignas(16) static constexpr std::uint64_t kK1K2[] = {0x0154442BD4, 0x01C6E41596};
+    alignas(16) static constexpr std::uint64_t kK3K4[] = {0x01751997D0, 0x00CCAA009E};
+    alignas(16) static constexpr std::uint64_t kK5K0[] = {0x0163CD6124, 0x0000000000};
+    alignas(16) static constexpr std::uint64_t kPoly[] = {0x01DB710641, 0x01F7011641};
+
+    const auto load = [](const std::byte *at) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(at)); };
+
+    __m128i x1 = _mm_xor_si128(load(data), _mm_cvtsi32_si128(static_cast<int>(reg)));
+    __m128i x2 = load(data + 16);
+    __m128i x3 = load(data + 32);
+    __m128i x4 = load(data + 48);
+    data += 64;
+    size -= 64;
+
+    __m128i keys = _mm_load_si128(reinterpret_cast<const __m128i *>(kK1K2));
+    for (; size >= 64; data += 64, size -= 64)
+    {
+        x1 = clmulFold(x1, keys, load(data));
+        x2 = clmulFold(x2, keys, load(data + 16));
+        x3 = clmulFold(x3, keys, load(data + 32));
+        x4 = clmulFold(x4, keys, load(data + 48));
+    }
+
+    keys = _mm_load_si128(reinterpret_cast<const __m128i *>(kK3K4));
+    x1 = clmulFold(x1, keys, x2);
+    x1 = clmulFold(x1, keys, x3);
+    x1 = clmulFold(x1, keys, x4);
+    for (; size >= 16; data += 16, size -= 16)
+    {
+        x1 = clmulFold(x1, keys, load(data));
+    }
+
+    // 128 -> 64 bits.
+    const __m128i low32 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x2 = _mm_clmulepi64_si128(x1, keys, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+    keys = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(kK5K0));
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, low32), keys, 0x00), x2);
+
+    // Barrett reduction to 32 bits.
+    keys = _mm_load_si128(reinterpret_cast<const __m128i *>(kPoly));
+    x2 = _mm_and_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, low32), keys, 0x10), low32);
+    x2 = _mm_clmulepi64_si128(x2, keys, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+    return static_cast<std::uint32_t>(_mm_extract_epi32(x1, 1));
+}
+#endif
+
+} // namespace detail::crc
+
+template <int Width, std::uint64_t Poly, std::uint64_t Init, bool ReflectIn, bool ReflectOut, std::uint64_t XorOut,
+          std::uint64_t Check>
+consteval auto CrcSpec::make() -> CrcSpec
+{
+    static_assert(Width >= 8 && Width <= 64, "CRC width must be 8-64 bits");
+    static_assert((Poly & ~detail::crc::widthMask(Width)) == 0, "Polynomial must fit in the CRC width");
+    static_assert((Init & ~detail::crc::widthMask(Width)) == 0, "Init must fit in the CRC width");
+    static_assert((XorOut & ~detail::crc::widthMask(Width)) == 0, "XorOut must fit in the CRC width");
+    constexpr CrcSpec kSpec{Width, Poly, Init, ReflectIn, ReflectOut, XorOut, Check};
+    static_assert(detail::crc::bitwise(kSpec, detail::crc::kCheckInput) == Check,
+                  "Check value does not match CRC(\"123456789\")");
+    return kSpec;
+}
+
+// Best CrcKernel the running CPU supports for CRC-32.
+[[nodiscard]] inline auto supportedCrcKernel() noexcept -> CrcKernel
+{
+#if CPP_CORE_CRC_X86
+    static const CrcKernel kernel = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1") ? CrcKernel::kClmul
+                                                                                     : CrcKernel::kSlicingBy8;
+    }();
+    return kernel;
+#else
+    return CrcKernel::kSlicingBy8;
+#endif
+}
+
+/**
+ * Streaming CRC engine for @p Spec. Tables are generated at compile time, once per spec, and shared
+ * by every translation unit. Runtime updates use slicing-by-8; the CRC-32 polynomial additionally
+ * folds large inputs with PCLMULQDQ when the CPU supports it.
+ *   const auto crc = Crc16Modbus::compute(frame);
+ *   Crc32 crc; crc.update(header).update(payload); crc.value();
+ */
+template <CrcSpec Spec> class Crc
+{
+  public:
+    using Value = detail::crc::ValueFor<Spec.width>;
+
+    constexpr auto update(std::span<const std::byte> data) noexcept -> Crc &
+    {
+        if !consteval
+        {
+            if constexpr (kClmulCapable)
+            {
+                if (supportedCrcKernel() == CrcKernel::kClmul)
+                {
+                    data = foldClmul(data);
+                }
+            }
+        }
+        updateTables(data);
+        return *this;
+    }
+
+    [[nodiscard]] constexpr auto value() const noexcept -> Value
+    {
+        const auto raw = Spec.reflect_in ? static_cast<std::uint64_t>(register_)
+                                         : static_cast<std::uint64_t>(register_) >> kAlignShift;
+        const auto out = Spec.reflect_in == Spec.reflect_out ? raw : detail::crc::reflect(raw, Spec.width);
+        return static_cast<Value>(out ^ Spec.xor_out);
+    }
+
+    constexpr auto reset() noexcept -> void
+    {
+        register_ = kInitialRegister;
+    }
+
+    [[nodiscard]] static constexpr auto compute(std::span<const std::byte> data) noexcept -> Value
+    {
+        return Crc{}.update(data).value();
+    }
+
+    // Explicit-kernel variant for tests and benchmarks. @p kernel must not exceed supportedCrcKernel().
+    [[nodiscard]] static auto compute(std::span<const std::byte> data, CrcKernel kernel) noexcept -> Value
+    {
+        Crc crc;
+        if constexpr (kClmulCapable)
+        {
+            if (kernel == CrcKernel::kClmul)
+            {
+                data = crc.foldClmul(data);
+            }
+        }
+        crc.updateTables(data);
+        return crc.value();
+    }
+
+  private:
+    static constexpr int kRegisterBits = 8 * sizeof(Value);
+    static constexpr int kAlignShift = Spec.reflect_in ? 0 : kRegisterBits - Spec.width;
+    static constexpr bool kClmulCapable =
+        CPP_CORE_CRC_X86 && Spec.width == 32 && Spec.poly == detail::crc::kCrc32Poly && Spec.reflect_in;
+    static constexpr Value kInitialRegister = static_cast<Value>(
+        Spec.reflect_in ? detail::crc::reflect(Spec.init, Spec.width) : Spec.init << kAlignShift);
+    static constexpr detail::crc::Tables<Value> kTables = detail::crc::makeTables<Value>(Spec);
+
+    // Consumes the 16-byte aligned prefix of @p data, returns the tail left for the tables.
+    auto foldClmul(std::span<const std::byte> data) noexcept -> std::span<const std::byte>
+    {
+#if CPP_CORE_CRC_X86
+        if (data.size() >= detail::crc::kClmulMinSize)
+        {
+            const auto folded = data.size() & ~std::size_t{15};
+            register_ = static_cast<Value>(
+                detail::crc::crc32Clmul(static_cast<std::uint32_t>(register_), data.data(), folded));
+            return data.subspan(folded);
+        }
+#endif
+        return data;
+    }
+
+    constexpr auto updateTables(std::span<const std::byte> data) noexcept -> void
+    {
+        auto reg = static_cast<std::uint64_t>(register_);
+        const auto *at = data.data();
+        auto size = data.size();
+        const auto &t = kTables;
+        for (; size >= 8; at += 8, size -= 8)
+        {
+            if constexpr (Spec.reflect_in)
+            {
+                const auto x = detail::crc::loadLe64(at) ^ reg;
+                reg = static_cast<std::uint64_t>(t[7][x & 0xFFU]) ^ t[6][(x >> 8) & 0xFFU] ^ t[5][(x >> 16) & 0xFFU]
+                      ^ t[4][(x >> 24) & 0xFFU] ^ t[3][(x >> 32) & 0xFFU] ^ t[2][(x >> 40) & 0xFFU]
+                      ^ t[1][(x >> 48) & 0xFFU] ^ t[0][x >> 56];
+            }
+            else
+            {
+                const auto x = detail::crc::loadBe64(at) ^ (reg << (64 - kRegisterBits));
+                reg = static_cast<std::uint64_t>(t[7][x >> 56]) ^ t[6][(x >> 48) & 0xFFU] ^ t[5][(x >> 40) & 0xFFU]
+                      ^ t[4][(x >> 32) & 0xFFU] ^ t[3][(x >> 24) & 0xFFU] ^ t[2][(x >> 16) & 0xFFU]
+                      ^ t[1][(x >> 8) & 0xFFU] ^ t[0][x & 0xFFU];
+            }
+        }
+        for (; size > 0; ++at, --size)
+        {
+            const auto byte = static_cast<std::uint64_t>(*at);
+            if constexpr (Spec.reflect_in)
+            {
+                reg = (reg >> 8) ^ t[0][(reg ^ byte) & 0xFFU];
+            }
+            else
+            {
+                reg = ((reg << 8) & detail::crc::widthMask(kRegisterBits)) ^ t[0][(reg >> (kRegisterBits - 8)) ^ byte];
+            }
+        }
+        register_ = static_cast<Value>(reg);
+    }
+
+    Value register_{kInitialRegister};
+};
+
+inline constexpr CrcSpec kCrc8Maxim = CrcSpec::make<8, 0x31, 0x00, true, true, 0x00, 0xA1>();
+inline constexpr CrcSpec kCrc16Modbus = CrcSpec::make<16, 0x8005, 0xFFFF, true, true, 0x0000, 0x4B37>();
+// CRC-16/CCITT-FALSE (a.k.a. CRC-16/IBM-3740), the variant most serial protocols mean by "CCITT".
+inline constexpr CrcSpec kCrc16Ccitt = CrcSpec::make<16, 0x1021, 0xFFFF, false, false, 0x0000, 0x29B1>();
+inline constexpr CrcSpec kCrc32 =
+    CrcSpec::make<32, detail::crc::kCrc32Poly, 0xFFFFFFFF, true, true, 0xFFFFFFFF, 0xCBF43926>();
+
+using Crc8Maxim = Crc<kCrc8Maxim>;
+using Crc16Modbus = Crc<kCrc16Modbus>;
+using Crc16Ccitt = Crc<kCrc16Ccitt>;
+using Crc32 = Crc<kCrc32>;
+
+} // namespace cpp_core
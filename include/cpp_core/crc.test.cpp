@@ -0,0 +1,75 @@
+#include "cpp_core/crc.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace cpp_core::tests::crc
+{
+
+// Catalogue entries beyond the presets: 64-bit, non-byte width, non-reflected CRC-32 and mixed reflection.
+constexpr auto kCrc64Xz =
+    CrcSpec::make<64, 0x42F0E1EBA9EA3693, ~std::uint64_t{0}, true, true, ~std::uint64_t{0}, 0x995DC9BBDF1939FA>();
+constexpr auto kCrc12Umts = CrcSpec::make<12, 0x80F, 0x000, false, true, 0x000, 0xDAF>();
+constexpr auto kCrc32Bzip2 = CrcSpec::make<32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0xFFFFFFFF, 0xFC891918>();
+constexpr auto kCrc8Smbus = CrcSpec::make<8, 0x07, 0x00, false, false, 0x00, 0xF4>();
+
+constexpr auto kCheck = std::span<const std::byte>(detail::crc::kCheckInput);
+
+// 61 bytes: several slicing-by-8 blocks plus a byte-wise tail.
+consteval auto pattern() -> std::array<std::byte, 61>
+{
+    std::array<std::byte, 61> out{};
+    for (std::size_t i = 0; i < out.size(); ++i)
+    {
+        out[i] = static_cast<std::byte>((i * 37U) ^ 0x5AU);
+    }
+    return out;
+}
+
+template <CrcSpec Spec> consteval auto matchesReference() -> bool
+{
+    constexpr auto kData = pattern();
+    return Crc<Spec>::compute(kCheck) == Spec.check
+           && Crc<Spec>::compute(kData) == detail::crc::bitwise(Spec, kData);
+}
+
+template <CrcSpec Spec> consteval auto resumesAcrossChunks() -> bool
+{
+    constexpr auto kData = pattern();
+    Crc<Spec> crc;
+    crc.update(std::span(kData).first(3)).update(std::span(kData).subspan(3, 20)).update(std::span(kData).subspan(23));
+    const bool split = crc.value() == Crc<Spec>::compute(kData);
+    crc.reset();
+    return split && crc.update(kCheck).value() == Spec.check;
+}
+
+static_assert(std::is_same_v<Crc8Maxim::Value, std::uint8_t>);
+static_assert(std::is_same_v<Crc16Modbus::Value, std::uint16_t>);
+static_assert(std::is_same_v<Crc<kCrc12Umts>::Value, std::uint16_t>);
+static_assert(std::is_same_v<Crc32::Value, std::uint32_t>);
+static_assert(std::is_same_v<Crc<kCrc64Xz>::Value, std::uint64_t>);
+
+static_assert(Crc8Maxim::compute(kCheck) == 0xA1);
+static_assert(Crc16Modbus::compute(kCheck) == 0x4B37);
+static_assert(Crc16Ccitt::compute(kCheck) == 0x29B1);
+static_assert(Crc32::compute(kCheck) == 0xCBF43926);
+static_assert(Crc32::compute({}) == 0);
+
+static_assert(matchesReference<kCrc8Maxim>());
+static_assert(matchesReference<kCrc16Modbus>());
+static_assert(matchesReference<kCrc16Ccitt>());
+static_assert(matchesReference<kCrc32>());
+static_assert(matchesReference<kCrc64Xz>());
+static_assert(matchesReference<kCrc12Umts>());
+static_assert(matchesReference<kCrc32Bzip2>());
+static_assert(matchesReference<kCrc8Smbus>());
+
+static_assert(resumesAcrossChunks<kCrc16Modbus>());
+static_assert(resumesAcrossChunks<kCrc16Ccitt>());
+static_assert(resumesAcrossChunks<kCrc32>());
+static_assert(resumesAcrossChunks<kCrc12Umts>());
+
+} // namespace cpp_core::tests::crc
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    using DataCallbackT = void (*)(int64_t handle, const void *data, int size, void *user_data);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "strong_types.hpp"
+
+#include <chrono>
+#include <limits>
+
+namespace cpp_core
+{
+
+/**
+ * Absolute expiry point for the budget-based calls (serialReadFor() and friends).
+ * Bindings create it once per call and derive each OS-level wait from the remaining budget,
+ * so the total duration stays bounded no matter how many waits the call needs.
+ *   const auto deadline = Deadline<>::after(TotalTimeoutMs{total_timeout_ms});
+ *   while (!done && !deadline.expired()) { waitReadable(fd, deadline.remaining().get()); ... }
+ */
+template <typename Clock = std::chrono::steady_clock> class Deadline
+{
+  public:
+    using ClockType = Clock;
+    using TimePoint = typename Clock::time_point;
+
+    constexpr explicit Deadline(TimePoint expiry) noexcept : expiry_(expiry)
+    {
+    }
+
+    // Negative budgets are treated as 0 (already expired).
+    [[nodiscard]] static auto after(TotalTimeoutMs budget) -> Deadline
+    {
+        return Deadline{Clock::now() + std::chrono::milliseconds{budget.get() < 0 ? 0 : budget.get()}};
+    }
+
+    [[nodiscard]] constexpr auto expiry() const noexcept -> TimePoint
+    {
+        return expiry_;
+    }
+
+    [[nodiscard]] constexpr auto expiredAt(TimePoint now) const noexcept -> bool
+    {
+        return now >= expiry_;
+    }
+
+    // Remaining budget at @p now, rounded up to whole milliseconds so a wait never ends before the deadline.
+    [[nodiscard]] constexpr auto remainingAt(TimePoint now) const noexcept -> TimeoutMs
+    {
+        if (expiredAt(now))
+        {
+            return TimeoutMs{0};
+        }
+        const auto left = std::chrono::ceil<std::chrono::milliseconds>(expiry_ - now).count();
+        if (left > std::numeric_limits<int>::max())
+        {
+            return TimeoutMs{std::numeric_limits<int>::max()};
+        }
+        return TimeoutMs{static_cast<int>(left)};
+    }
+
+    [[nodiscard]] auto expired() const -> bool
+    {
+        return expiredAt(Clock::now());
+    }
+
+    [[nodiscard]] auto remaining() const -> TimeoutMs
+    {
+        return remainingAt(Clock::now());
+    }
+
+  private:
+    TimePoint expiry_;
+};
+
+} // namespace cpp_core
@@ -0,0 +1,22 @@
+#include "cpp_core/deadline.hpp"
+
+#include <chrono>
+
+namespace cpp_core::tests::deadline
+{
+
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+using TimePoint = std::chrono::steady_clock::time_point;
+
+constexpr Deadline<> kDeadline{TimePoint{milliseconds{100}}};
+
+static_assert(!kDeadline.expiredAt(TimePoint{milliseconds{99}}));
+static_assert(kDeadline.expiredAt(TimePoint{milliseconds{100}}));
+static_assert(kDeadline.remainingAt(TimePoint{milliseconds{40}}) == TimeoutMs{60});
+static_assert(kDeadline.remainingAt(TimePoint{microseconds{99'001}}) == TimeoutMs{1});
+static_assert(kDeadline.remainingAt(TimePoint{milliseconds{250}}) == TimeoutMs{0});
+
+static_assert(TotalTimeoutMs{20} + TotalTimeoutMs{5} == TotalTimeoutMs{25});
+
+} // namespace cpp_core::tests::deadline
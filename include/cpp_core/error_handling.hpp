@@ -2,8 +2,10 @@
 
 #include "status_code.h"
 
+#include <algorithm>
+#include <array>
 #include <concepts>
-#include <string>
+#include <cstddef>
 #include <string_view>
 #include <type_traits>
 #include <utility>
@@ -33,30 +35,85 @@ concept StatusConvertible = std::is_arithmetic_v<T> && requires(StatusCodeValue
 
 // Error invocation
 
-// Safely invoke an error callback, does nothing if callback is nullptr.
-template <ErrorCallback Callback>
-constexpr auto invokeError(Callback &&callback, StatusCodeValue code, std::string_view message) noexcept -> void
+// Longest message handed to an error callback, including the terminating NUL; longer text is truncated.
+inline constexpr std::size_t kErrorMessageBufferSize = 256;
+
+namespace detail
+{
+
+template <ErrorCallback Callback> constexpr auto hasCallback(const Callback &callback) noexcept -> bool
 {
     if constexpr (std::is_null_pointer_v<std::remove_cvref_t<Callback>>)
     {
         (void)callback;
-        (void)code;
-        (void)message;
-        return;
+        return false;
+    }
+    else if constexpr (requires { callback != nullptr; })
+    {
+        return callback != nullptr;
     }
     else
     {
-        if (callback != nullptr)
+        return true;
+    }
+}
+
+// Append @p part to the NUL-terminated text in @p buffer, truncating at the buffer end.
+template <std::size_t N>
+constexpr auto appendMessage(std::array<char, N> &buffer, std::size_t &size, std::string_view part) noexcept -> void
+{
+    const auto count = std::min(part.size(), N - 1 - size);
+    std::copy_n(part.begin(), count, buffer.begin() + static_cast<std::ptrdiff_t>(size));
+    size += count;
+    buffer[size] = '\0';
+}
+
+} // namespace detail
+
+// Invoke an error callback with an already NUL-terminated message, does nothing if callback is nullptr.
+template <ErrorCallback Callback>
+constexpr auto invokeError(Callback &&callback, StatusCodeValue code, const char *message) noexcept -> void
+{
+    if constexpr (!std::is_null_pointer_v<std::remove_cvref_t<Callback>>)
+    {
+        if (detail::hasCallback(callback))
         {
-            const std::string term(message);
-            callback(static_cast<int>(code), term.c_str());
+            callback(static_cast<int>(code), message);
         }
     }
+    else
+    {
+        (void)callback;
+        (void)code;
+        (void)message;
+    }
+}
+
+// Safely invoke an error callback, does nothing if callback is nullptr.
+// The message is NUL-terminated in a stack buffer, and only when there is a callback to receive it.
+template <ErrorCallback Callback>
+constexpr auto invokeError(Callback &&callback, StatusCodeValue code, std::string_view message) noexcept -> void
+{
+    if (!detail::hasCallback(callback))
+    {
+        return;
+    }
+    std::array<char, kErrorMessageBufferSize> term{};
+    std::size_t size = 0;
+    detail::appendMessage(term, size, message);
+    invokeError(std::forward<Callback>(callback), code, term.data());
 }
 
 // Fail helpers (concept-constrained)
 
 // Report failure through callback and return the status code cast to Ret.
+template <StatusConvertible Ret, ErrorCallback Callback>
+constexpr auto failMsg(Callback &&callback, StatusCodeValue code, const char *message) -> Ret
+{
+    invokeError(std::forward<Callback>(callback), code, message);
+    return static_cast<Ret>(code);
+}
+
 template <StatusConvertible Ret, ErrorCallback Callback>
 constexpr auto failMsg(Callback &&callback, StatusCodeValue code, std::string_view message) -> Ret
 {
@@ -64,16 +121,20 @@ constexpr auto failMsg(Callback &&callback, StatusCodeValue code, std::string_vi
     return static_cast<Ret>(code);
 }
 
-// Overload that builds the message by concatenating a prefix and a detail string.
+// Overload that builds "prefix: detail" on the stack, only when a callback is registered.
 template <StatusConvertible Ret, ErrorCallback Callback>
-auto failMsg(Callback &&callback, StatusCodeValue code, std::string_view prefix, std::string_view detail) -> Ret
+constexpr auto failMsg(Callback &&callback, StatusCodeValue code, std::string_view prefix, std::string_view detail)
+    -> Ret
 {
-    std::string full;
-    full.reserve(prefix.size() + 2 + detail.size());
-    full.append(prefix);
-    full.append(": ");
-    full.append(detail);
-    invokeError(std::forward<Callback>(callback), code, full);
+    if (detail::hasCallback(callback))
+    {
+        std::array<char, kErrorMessageBufferSize> full{};
+        std::size_t size = 0;
+        detail::appendMessage(full, size, prefix);
+        detail::appendMessage(full, size, ": ");
+        detail::appendMessage(full, size, detail);
+        invokeError(std::forward<Callback>(callback), code, full.data());
+    }
     return static_cast<Ret>(code);
 }
 
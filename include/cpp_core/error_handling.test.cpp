@@ -0,0 +1,44 @@
+#include "cpp_core/error_handling.hpp"
+
+#include <string_view>
+
+namespace cpp_core::tests::error_handling
+{
+
+struct Recorder
+{
+    int calls = 0;
+    int code = 0;
+    std::string_view text;
+};
+
+consteval auto formatsPrefixAndDetail() -> bool
+{
+    Recorder recorder;
+    const auto callback = [&recorder](int code, const char *message) {
+        ++recorder.calls;
+        recorder.code = code;
+        recorder.text = std::string_view(message) == "Open failed: /dev/ttyUSB0" ? "match" : "mismatch";
+    };
+    const auto result = failMsg<int>(callback, -7, "Open failed", "/dev/ttyUSB0");
+    return result == -7 && recorder.calls == 1 && recorder.code == -7 && recorder.text == "match";
+}
+
+consteval auto terminatesViews() -> bool
+{
+    Recorder recorder;
+    const auto callback = [&recorder](int, const char *message) {
+        ++recorder.calls;
+        recorder.text = std::string_view(message) == "Read" ? "match" : "mismatch";
+    };
+    constexpr std::string_view kUnterminated = "Read timed out";
+    invokeError(callback, -1, kUnterminated.substr(0, 4));
+    return recorder.calls == 1 && recorder.text == "match";
+}
+
+static_assert(formatsPrefixAndDetail());
+static_assert(terminatesViews());
+static_assert(failMsg<int>(nullptr, -3, "Open failed", "/dev/ttyUSB0") == -3);
+static_assert(failMsg<long>(nullptr, -4, "Invalid handle") == -4L);
+
+} // namespace cpp_core::tests::error_handling
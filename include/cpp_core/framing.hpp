@@ -0,0 +1,50 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+namespace cpp_core
+{
+
+// Outcome of one streaming decoder step (CobsDecoder, SlipDecoder).
+enum class FrameStatus : int
+{
+    kNeedMore = 0,
+    kFrame = 1,
+    kError = 2,
+};
+
+/**
+ * Result of a decode() call. `consumed` input bytes were used; on kFrame the complete frame is in the
+ * caller's frame buffer (see frameSize()), on kError the partial frame was dropped and the decoder
+ * resynchronises at the next delimiter.
+ *   while (!chunk.empty()) {
+ *       const auto step = decoder.decode(chunk, frame);
+ *       chunk = chunk.subspan(step.consumed);
+ *       if (step.status == FrameStatus::kFrame) { onFrame(std::span(frame).first(decoder.frameSize())); }
+ *   }
+ */
+struct FrameProgress
+{
+    FrameStatus status;
+    std::size_t consumed;
+};
+
+// Result of an encode()/finish() call: input bytes taken and output bytes written.
+struct CodecProgress
+{
+    std::size_t consumed;
+    std::size_t produced;
+};
+
+// clang-format off
+// Streaming decoder shape shared by CobsDecoder and SlipDecoder.
+template <typename D>
+concept FrameDecoder = requires(D &decoder, std::span<const std::byte> input, std::span<std::byte> frame) {
+    { decoder.decode(input, frame) } -> std::same_as<FrameProgress>;
+    { decoder.frameSize() } -> std::convertible_to<std::size_t>;
+};
+// clang-format on
+
+} // namespace cpp_core
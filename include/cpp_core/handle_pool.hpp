@@ -0,0 +1,162 @@
+#pragma once
+
+#include "serial_config.hpp"
+#include "unique_resource.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cpp_core
+{
+
+/**
+ * Warm-reopen pool behind serialSetPoolOptions(): serialClose() parks the still-configured handle
+ * keyed by path + SerialConfig, and a later serialOpen() with the same key takes it back instead of
+ * paying for open + termios/DCB setup again. Disabled (max_idle == 0) until configured.
+ *
+ * Idle handles are evicted lazily on the next pool call, oldest first; evicted handles are closed
+ * through Traits::close() after the pool lock is released.
+ *   // serialOpen():
+ *   if (auto parked = pool.acquire(path, config)) { return parked.release(); }
+ *   // serialClose():
+ *   pool.park(path, port.config, std::move(fd), [](int fd) { return tcflush(fd, TCIFLUSH) == 0; });
+ */
+template <ResourceTraitSpec Traits, typename Clock = std::chrono::steady_clock> class HandlePool
+{
+  public:
+    using Resource = UniqueResource<Traits>;
+    using TimePoint = typename Clock::time_point;
+
+    // @p max_idle 0 disables pooling and closes every parked handle. @p idle_timeout 0 means no expiry.
+    auto setOptions(std::size_t max_idle, std::chrono::milliseconds idle_timeout) -> void
+    {
+        std::vector<Entry> evicted;
+        const std::scoped_lock lock(mutex_);
+        max_idle_ = max_idle;
+        idle_timeout_ = idle_timeout;
+        evictLocked(Clock::now(), evicted);
+    }
+
+    [[nodiscard]] auto enabled() const -> bool
+    {
+        const std::scoped_lock lock(mutex_);
+        return max_idle_ != 0;
+    }
+
+    // Take the most recently parked handle for @p path + @p config, or an invalid Resource.
+    [[nodiscard]] auto acquire(std::string_view path, const SerialConfig &config) -> Resource
+    {
+        std::vector<Entry> evicted;
+        const std::scoped_lock lock(mutex_);
+        evictLocked(Clock::now(), evicted);
+        const auto match = std::find_if(entries_.rbegin(), entries_.rend(), [&](const Entry &entry) {
+            return entry.path == path && entry.config == config;
+        });
+        if (match == entries_.rend())
+        {
+            return Resource{};
+        }
+        auto resource = std::move(match->resource);
+        entries_.erase(std::next(match).base());
+        return resource;
+    }
+
+    /**
+     * Park @p resource instead of closing it. @p flush discards pending input (serialClearBufferIn()
+     * semantics) so the next owner starts clean; if it fails, or pooling is disabled, the handle is closed.
+     * Returns true if the handle was parked.
+     */
+    template <typename Flush>
+    requires std::is_invocable_r_v<bool, Flush, typename Resource::HandleType>
+    auto park(std::string path, const SerialConfig &config, Resource resource, Flush &&flush) -> bool
+    {
+        if (!resource || !std::invoke(std::forward<Flush>(flush), resource.get()))
+        {
+            return false;
+        }
+        std::vector<Entry> evicted;
+        const std::scoped_lock lock(mutex_);
+        if (max_idle_ == 0)
+        {
+            return false;
+        }
+        const auto now = Clock::now();
+        entries_.push_back(Entry{std::move(path), config, std::move(resource), now});
+        evictLocked(now, evicted);
+        return true;
+    }
+
+    // Close every handle parked for @p path, whatever its config, e.g. before reopening it with other settings.
+    // Returns how many were closed.
+    auto evict(std::string_view path) -> std::size_t
+    {
+        std::vector<Entry> evicted;
+        {
+            const std::scoped_lock lock(mutex_);
+            const auto matched = std::stable_partition(entries_.begin(), entries_.end(),
+                                                       [&](const Entry &entry) { return entry.path != path; });
+            std::move(matched, entries_.end(), std::back_inserter(evicted));
+            entries_.erase(matched, entries_.end());
+        }
+        return evicted.size();
+    }
+
+    // Close every parked handle (serialClearPool()). Returns how many were closed.
+    auto clear() -> std::size_t
+    {
+        std::vector<Entry> evicted;
+        {
+            const std::scoped_lock lock(mutex_);
+            evicted.swap(entries_);
+        }
+        return evicted.size();
+    }
+
+    [[nodiscard]] auto size() const -> std::size_t
+    {
+        const std::scoped_lock lock(mutex_);
+        return entries_.size();
+    }
+
+  private:
+    struct Entry
+    {
+        std::string path;
+        SerialConfig config;
+        Resource resource;
+        TimePoint parked_at;
+    };
+
+    // Moves expired and surplus entries (oldest first) into @p evicted. Callers declare @p evicted before
+    // taking the lock, so the evicted handles are closed after it is released.
+    auto evictLocked(TimePoint now, std::vector<Entry> &evicted) -> void
+    {
+        const auto expired = [&](const Entry &entry) {
+            return idle_timeout_.count() > 0 && now - entry.parked_at >= idle_timeout_;
+        };
+        auto keep_from = std::find_if_not(entries_.begin(), entries_.end(), expired);
+        const auto surplus = static_cast<std::size_t>(std::distance(keep_from, entries_.end()));
+        if (surplus > max_idle_)
+        {
+            std::advance(keep_from, static_cast<std::ptrdiff_t>(surplus - max_idle_));
+        }
+        std::move(entries_.begin(), keep_from, std::back_inserter(evicted));
+        entries_.erase(entries_.begin(), keep_from);
+    }
+
+    mutable std::mutex mutex_;
+    std::vector<Entry> entries_; // Oldest first.
+    std::size_t max_idle_{0};
+    std::chrono::milliseconds idle_timeout_{0};
+};
+
+} // namespace cpp_core
@@ -0,0 +1,52 @@
+#include "cpp_core/handle_pool.hpp"
+
+#include <chrono>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+// Interface checks only; bench/handle_pool.bench.cpp exercises eviction, expiry and close-outside-lock at run time.
+namespace cpp_core::tests::handle_pool
+{
+
+struct FdTraits
+{
+    using handle_type = int;
+
+    static constexpr auto invalid() noexcept -> handle_type
+    {
+        return -1;
+    }
+
+    static auto close(handle_type) noexcept -> void
+    {
+    }
+};
+
+struct ManualClock
+{
+    using duration = std::chrono::nanoseconds;
+    using time_point = std::chrono::time_point<ManualClock>;
+
+    static auto now() noexcept -> time_point
+    {
+        return time_point{};
+    }
+};
+
+using Pool = HandlePool<FdTraits, ManualClock>;
+
+template <typename Flush>
+concept Parkable = requires(Pool &pool, Pool::Resource resource, Flush flush) {
+    pool.park(std::string{}, SerialConfig{}, std::move(resource), flush);
+};
+
+static_assert(std::is_same_v<Pool::Resource, UniqueResource<FdTraits>>);
+static_assert(std::is_same_v<Pool::TimePoint, ManualClock::time_point>);
+static_assert(!std::is_copy_constructible_v<Pool> && !std::is_copy_assignable_v<Pool>);
+static_assert(Parkable<bool (*)(int)>);
+static_assert(Parkable<decltype([](int) { return true; })>);
+static_assert(!Parkable<void (*)(int)>);
+static_assert(!Parkable<bool (*)(const char *)>);
+
+} // namespace cpp_core::tests::handle_pool
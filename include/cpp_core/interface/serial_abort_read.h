@@ -12,7 +12,8 @@ extern "C"
      * @brief Abort a blocking read operation running in a different thread.
      *
      * The target read function returns immediately with
-     * ::cpp_core::StatusCode::Io::kAbortReadError.
+     * ::cpp_core::StatusCode::Io::kAbortReadError. Read operations queued with
+     * serialSubmit() for this handle complete with the same code.
      *
      * @param handle Port handle.
      * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
@@ -0,0 +1,31 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Record a port's traffic into a capture file.
+     *
+     * From now until serialCaptureStop() or serialClose(), every byte received and sent, every modem-line
+     * change, configuration change and break on @p handle is appended to @p path with a monotonic
+     * timestamp, in the format of cpp_core/capture.hpp. The file starts with the current configuration
+     * and line state. Starting a new capture on the same handle ends the previous one.
+     *
+     * Replay a capture through the loopback binding by opening `replay://PATH`.
+     *
+     * @param handle Port handle.
+     * @param path Capture file, created or truncated (must not be `nullptr`).
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return 0 on success or a negative error code from ::cpp_core::StatusCode on error.
+     */
+    MODULE_API auto serialCaptureStart(int64_t handle, const char *path, ErrorCallbackT error_callback = nullptr)
+        -> int;
+
+#ifdef __cplusplus
+}
+#endif
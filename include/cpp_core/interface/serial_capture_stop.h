@@ -0,0 +1,26 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief End the capture started with serialCaptureStart() and close its file.
+     *
+     * Bytes that have arrived by the time of the call are recorded even if they were not read yet.
+     * Does nothing if the handle is not capturing.
+     *
+     * @param handle Port handle.
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return 0 on success or a negative error code from ::cpp_core::StatusCode on error; WriteError if any part
+     *         of the capture could not be written.
+     */
+    MODULE_API auto serialCaptureStop(int64_t handle, ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
@@ -12,7 +12,7 @@ extern "C"
      * @brief Clear (flush) the device's input buffer.
      *
      * Discards every byte the driver has already received but the application
-     * has not yet read.
+     * has not yet read, including the handle's read-ahead buffer.
      *
      * @param handle Port handle.
      * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
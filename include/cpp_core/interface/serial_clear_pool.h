@@ -0,0 +1,24 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Close every handle parked in the warm-reopen pool.
+     *
+     * Pool options set with serialSetPoolOptions() stay in effect; handles closed afterwards are parked
+     * again. Call before process exit or when a device was unplugged to release it immediately.
+     *
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return Number of handles closed or a negative error code from ::cpp_core::StatusCode on error.
+     */
+    MODULE_API auto serialClearPool(ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
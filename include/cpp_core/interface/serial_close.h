@@ -14,6 +14,10 @@ extern "C"
      * The handle becomes invalid after the call. Passing an already invalid
      * (<= 0) handle is a no-op.
      *
+     * With pooling enabled (serialSetPoolOptions()), the device stays open and the handle is parked for
+     * reuse by a matching serialOpen(). Parking does what a close would: blocked and queued calls abort,
+     * pending input is discarded, DTR and RTS drop, and per-handle callbacks and statistics are reset.
+     *
      * @param handle Handle obtained from serialOpen().
      * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
      * @return 0 on success or a negative error code from ::cpp_core::StatusCode on error.
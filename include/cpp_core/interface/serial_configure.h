@@ -0,0 +1,36 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include "../serial_line_config.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Apply a complete line configuration in a single step.
+     *
+     * Replaces a sequence of serialSetBaudrate(), serialSetDataBits(),
+     * serialSetParity(), serialSetStopBits() and serialSetFlowControl() calls.
+     * All settings are written to the driver in one OS call (one `tcsetattr` /
+     * `SetCommState`), so the line never passes through intermediate states.
+     *
+     * The binding caches the configuration last applied to the handle. If
+     * @p config equals that cache, the call returns 0 without touching the OS.
+     * If validation or the OS call fails, the previous configuration stays in
+     * effect.
+     *
+     * @param handle Port handle.
+     * @param config New configuration (must not be `nullptr`), see ::cpp_core::SerialLineConfig.
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return 0 on success or a negative error code from ::cpp_core::StatusCode on error (a
+     * ::cpp_core::StatusCode::Configuration code names the first invalid field).
+     */
+    MODULE_API auto serialConfigure(int64_t handle, const cpp_core::SerialLineConfig *config,
+                                    ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,27 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Run queued callbacks on the calling thread.
+     *
+     * Only meaningful after serialGetEventHandle() switched the binding into
+     * event-loop mode. Invokes up to @p max_events queued callbacks in the order
+     * the events occurred and resets the event handle once the queue is empty.
+     * Never blocks. Data passed to per-handle read callbacks was copied when the
+     * event was queued and is valid for the duration of the callback.
+     *
+     * @param max_events Maximum number of callbacks to run (> 0). Bounds the time spent in one loop iteration.
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return Number of callbacks invoked or a negative error code from ::cpp_core::StatusCode on error.
+     */
+    MODULE_API auto serialDispatchEvents(int max_events, ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
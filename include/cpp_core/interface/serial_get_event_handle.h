@@ -0,0 +1,35 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Export a process-wide OS object that signals pending callback work.
+     *
+     * The first call switches the binding into event-loop mode: callbacks
+     * (serialSetReadCallback(), serialSetWriteCallback(), serialSetErrorCallback(),
+     * serialMonitorPorts(), per-handle data callbacks) are no longer invoked on
+     * binding-owned threads. They are queued instead, and the returned object
+     * becomes ready until serialDispatchEvents() has run all of them. New
+     * completions for serialReap() also make it ready.
+     *
+     * - Linux: an `eventfd` that polls readable. Level-triggered.
+     * - Windows: a manual-reset event `HANDLE`.
+     *
+     * The object is owned by the binding and lives until process exit. Hosts may
+     * only wait on it. Repeated calls return the same value.
+     *
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return The waitable descriptor or `HANDLE` value (>= 0) or a negative error code from ::cpp_core::StatusCode on
+     * error.
+     */
+    MODULE_API auto serialGetEventHandle(ErrorCallbackT error_callback = nullptr) -> int64_t;
+
+#ifdef __cplusplus
+}
+#endif
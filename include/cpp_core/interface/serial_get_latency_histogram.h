@@ -0,0 +1,53 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    namespace cpp_core
+    {
+    struct LatencyBucket
+    {
+        int64_t upper_ns;
+        int64_t count;
+    };
+    } // namespace cpp_core
+
+    /**
+     * @brief Copy the call-latency histogram of one operation on one handle.
+     *
+     * Histograms are recorded only after serialSetLatencyHistograms() enabled them; handles opened
+     * before that have none. Each handle keeps one histogram per ::cpp_core::LatencyOp, measured from
+     * entry to return of the call (including time spent waiting for data). Queued operations
+     * (serialSubmit()) are recorded from the moment they start executing.
+     *
+     * @p handle 0 selects the binding-wide histograms, which aggregate every handle including closed
+     * ones. ::cpp_core::LatencyOp::kClose and failed opens are only recorded there; a handle's kOpen
+     * histogram holds the open that created it.
+     *
+     * Buckets are ordered by latency. `upper_ns` is the largest latency counted in the bucket, so the
+     * layout is self-describing; the last bucket has `upper_ns` = INT64_MAX and collects everything
+     * above the previous one. Counts are read one bucket at a time while other threads may be recording.
+     *
+     * Pass @p buckets = `nullptr` and @p bucket_count = 0 to query the number of buckets.
+     *
+     * @param handle Port handle, or 0 for the binding-wide histograms.
+     * @param op Operation selector (see ::cpp_core::LatencyOp).
+     * @param[out] buckets Destination array of at least @p bucket_count entries. May be `nullptr` if
+     * @p bucket_count is 0.
+     * @param bucket_count Number of entries @p buckets can hold (>= 0).
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return Total number of buckets (may exceed @p bucket_count; only the first @p bucket_count are
+     * written), 0 if no histogram is recorded for @p handle, or a negative error code from
+     * ::cpp_core::StatusCode on error.
+     */
+    MODULE_API auto serialGetLatencyHistogram(int64_t handle, int op, cpp_core::LatencyBucket *buckets,
+                                              int bucket_count, ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,63 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    namespace cpp_core
+    {
+    struct SerialStats
+    {
+        int64_t in_bytes_total;
+        int64_t out_bytes_total;
+        int64_t in_bytes_waiting;
+        int64_t out_bytes_waiting;
+        int64_t overrun_errors;
+        int64_t framing_errors;
+        int64_t parity_errors;
+        int64_t breaks;
+        int64_t read_calls;
+        int64_t write_calls;
+        int64_t read_timeouts;
+        int64_t write_timeouts;
+        int64_t read_aborts;
+        int64_t write_aborts;
+    };
+    } // namespace cpp_core
+
+    /**
+     * @brief Fill a statistics snapshot for an open port in a single call.
+     *
+     * Replaces separate serialInBytesTotal(), serialOutBytesTotal(),
+     * serialInBytesWaiting() and serialOutBytesWaiting() calls for dashboards
+     * that poll many ports.
+     *
+     * - `in_bytes_total` / `out_bytes_total`: same values as serialInBytesTotal() / serialOutBytesTotal().
+     * - `in_bytes_waiting` / `out_bytes_waiting`: same values as serialInBytesWaiting() / serialOutBytesWaiting().
+     * - `overrun_errors`, `framing_errors`, `parity_errors`, `breaks`: driver line-error counters since open, or 0
+     *   where the platform does not report them.
+     * - `read_calls` / `write_calls`: number of read / write calls on this handle, including scatter/gather, peek and
+     *   queued operations.
+     * - `read_timeouts` / `write_timeouts`: calls that returned 0 because their timeout elapsed.
+     * - `read_aborts` / `write_aborts`: calls that ended with ::cpp_core::StatusCode::Io::kAbortReadError /
+     *   ::cpp_core::StatusCode::Io::kAbortWriteError.
+     *
+     * Each field is read atomically, but fields are not captured at one common
+     * instant, so e.g. `read_calls` may already include a call whose bytes are not
+     * yet in `in_bytes_total`.
+     *
+     * @param handle Port handle.
+     * @param[out] out Destination structure (must not be `nullptr`).
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return 0 on success or a negative error code from ::cpp_core::StatusCode on error.
+     */
+    MODULE_API auto serialGetStats(int64_t handle, cpp_core::SerialStats *out, ErrorCallbackT error_callback = nullptr)
+        -> int;
+
+#ifdef __cplusplus
+}
+#endif
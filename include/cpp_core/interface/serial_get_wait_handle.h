@@ -0,0 +1,36 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Export an OS object that becomes ready when the port has data to read.
+     *
+     * Lets hosts put serial ports into their own event loop (epoll, libuv,
+     * tokio, IOCP) instead of parking a thread in serialRead().
+     *
+     * - Linux: a file descriptor that polls readable (`POLLIN` / `EPOLLIN`) as
+     *   long as a read call would return data without blocking, including bytes
+     *   in the handle's read-ahead buffer. Level-triggered.
+     * - Windows: an event `HANDLE` usable with `WaitForMultipleObjects`, signaled
+     *   under the same condition.
+     *
+     * The object is owned by the binding and stays valid until serialClose().
+     * Hosts may only wait on it; reading from, writing to or closing it is
+     * undefined behaviour. Repeated calls return the same value.
+     *
+     * @param handle Port handle.
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return The waitable descriptor or `HANDLE` value (>= 0) or a negative error code from ::cpp_core::StatusCode on
+     * error.
+     */
+    MODULE_API auto serialGetWaitHandle(int64_t handle, ErrorCallbackT error_callback = nullptr) -> int64_t;
+
+#ifdef __cplusplus
+}
+#endif
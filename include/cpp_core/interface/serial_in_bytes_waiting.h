@@ -14,6 +14,7 @@ extern "C"
      * The number reflects the size of the driver's RX FIFO **after** accounting
      * for data already consumed by the application.  A value of `0` therefore
      * means a read call would have to wait for the next byte to arrive.
+     * Bytes held in the handle's read-ahead buffer are included.
      *
      * @code{.c}
      * int pending = serialInBytesWaiting(h);
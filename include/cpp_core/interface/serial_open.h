@@ -15,6 +15,10 @@ extern "C"
      * the given line settings. The pointer is interpreted as
      * a UTF-8 encoded null-terminated string (`const char*`) on all platforms.
      *
+     * With pooling enabled (serialSetPoolOptions()), a handle parked by serialClose() for the same
+     * @p port and line settings is returned without touching the device. Handles parked for @p port with
+     * other settings are closed first, so they do not leave the port busy.
+     *
      * @param port Null-terminated device identifier (e.g. "COM3", "/dev/ttyUSB0"). Passing `nullptr` results in
      * a failure.
      * @param baudrate Desired baud rate in bit/s (>= 300).
@@ -0,0 +1,32 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Copy pending bytes without consuming them.
+     *
+     * Copies up to @p buffer_size bytes from the front of the handle's
+     * read-ahead buffer into @p buffer. The bytes stay queued and are returned
+     * again by the next read call. If the read-ahead buffer is empty, the call
+     * waits for at most @p timeout_ms milliseconds for data from the driver and
+     * moves whatever arrives into the read-ahead buffer.
+     *
+     * @param handle Port handle.
+     * @param buffer Destination buffer (must not be `nullptr`).
+     * @param buffer_size Size of @p buffer in bytes (> 0).
+     * @param timeout_ms Maximum time to wait for the first byte in milliseconds. 0 -> return immediately.
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return Bytes copied (0 on timeout) or a negative error code from ::cpp_core::StatusCode on error.
+     */
+    MODULE_API auto serialPeek(int64_t handle, void *buffer, int buffer_size, int timeout_ms,
+                               ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,50 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    namespace cpp_core
+    {
+    struct PollEntry
+    {
+        int64_t handle;
+        int events;
+        int revents;
+    };
+    } // namespace cpp_core
+
+    /**
+     * @brief Wait until any of several ports becomes readable or writable.
+     *
+     * Works like POSIX `poll()` over serial handles, so one thread can service
+     * many ports. For every entry the caller sets `handle` and an `events` mask;
+     * the binding overwrites `revents` with the readiness that was detected.
+     *
+     * Bits (see ::cpp_core::PollEvent): 1 = readable, 2 = writable, 4 = error,
+     * 8 = hangup (device removed), 16 = invalid handle. Error, hangup and invalid
+     * are always reported, even if not requested in `events`.
+     *
+     * "Readable" means a read call would return data without blocking, including
+     * bytes the binding has already buffered. Entries with `handle <= 0` are
+     * ignored and get `revents = 0`. serialAbortRead() on any polled handle wakes
+     * the call early.
+     *
+     * @param entries Array of @p entry_count entries (must not be `nullptr`).
+     * @param entry_count Number of entries (> 0).
+     * @param timeout_ms Maximum time to wait in milliseconds. 0 -> check and return immediately, negative -> wait
+     * without limit.
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return Number of entries with a non-zero `revents` (0 on timeout) or a negative error code from
+     * ::cpp_core::StatusCode on error.
+     */
+    MODULE_API auto serialPoll(cpp_core::PollEntry *entries, int entry_count, int timeout_ms,
+                               ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
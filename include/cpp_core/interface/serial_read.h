@@ -15,6 +15,14 @@ extern "C"
      * the FIRST byte. For every subsequent byte the individual timeout is
      * calculated as `timeout_ms * multiplier`.
      *
+     * Bytes already held in the handle's read-ahead buffer (left over from a
+     * previous delimiter read or pulled in by serialPeek()) are returned first.
+     * The delimiter reads (serialReadLine(), serialReadUntil(),
+     * serialReadUntilSequence() and their deadline-based variants) never
+     * discard bytes received after their terminator: they stay in that buffer
+     * for the next read call, which lets bindings pull large chunks from the
+     * OS instead of single bytes.
+     *
      * @param handle Port handle.
      * @param buffer Destination buffer (must not be `nullptr`).
      * @param buffer_size Size of @p buffer in bytes (> 0).
@@ -0,0 +1,33 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Read raw bytes with a single total time budget.
+     *
+     * Deadline-based variant of serialRead(). Instead of a per-byte timeout the
+     * whole call is bounded by @p total_timeout_ms: it returns as soon as
+     * @p buffer is full or the budget has elapsed, whichever comes first. The
+     * worst-case duration therefore does not grow with @p buffer_size.
+     *
+     * @param handle Port handle.
+     * @param buffer Destination buffer (must not be `nullptr`).
+     * @param buffer_size Size of @p buffer in bytes (> 0).
+     * @param total_timeout_ms Total time budget for the whole call in milliseconds. 0 -> only return bytes that are
+     * already available.
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return Bytes read before the budget elapsed (0 if none) or a negative error code from ::cpp_core::StatusCode on
+     * error.
+     */
+    MODULE_API auto serialReadFor(int64_t handle, void *buffer, int buffer_size, int total_timeout_ms,
+                                  ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,32 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Read a single line terminated by '\n' with a single total time budget.
+     *
+     * Deadline-based variant of serialReadLine(). The call returns once the
+     * newline has been received, @p buffer is full or @p total_timeout_ms has
+     * elapsed. If the budget runs out first, the bytes received so far are
+     * returned without a trailing newline.
+     *
+     * @param handle Port handle.
+     * @param buffer Destination buffer.
+     * @param buffer_size Capacity of @p buffer in bytes.
+     * @param total_timeout_ms Total time budget for the whole call in milliseconds.
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return Bytes read (including the newline if it arrived in time), 0 if nothing arrived or a negative error code
+     * from ::cpp_core::StatusCode on error.
+     */
+    MODULE_API auto serialReadLineFor(int64_t handle, void *buffer, int buffer_size, int total_timeout_ms,
+                                      ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
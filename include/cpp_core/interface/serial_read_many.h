@@ -0,0 +1,49 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    namespace cpp_core
+    {
+    struct ReadManyEntry
+    {
+        int64_t handle;
+        void *buffer;
+        int buffer_size;
+        int result;
+    };
+    } // namespace cpp_core
+
+    /**
+     * @brief Wait for any of several ports and drain every ready one in a single call.
+     *
+     * Blocks for at most @p timeout_ms milliseconds until at least one handle is
+     * readable (see serialPoll()). Then every readable handle is read without
+     * further blocking into its own `buffer`, up to `buffer_size` bytes.
+     *
+     * Each entry's `result` receives the bytes read for that handle, 0 if it had
+     * no data, or a negative ::cpp_core::StatusCode for that handle alone (for
+     * example ::cpp_core::StatusCode::Io::kAbortReadError after serialAbortRead()).
+     * A failing handle does not fail the whole call. Entries with `handle <= 0`
+     * are skipped and get `result = 0`.
+     *
+     * @param entries Array of @p entry_count entries (must not be `nullptr`). Every active entry needs a valid
+     * `buffer` and `buffer_size > 0`.
+     * @param entry_count Number of entries (> 0).
+     * @param timeout_ms Maximum time to wait for the first readable handle in milliseconds. 0 -> only drain what is
+     * already available, negative -> wait without limit.
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return Number of entries that received data (0 on timeout) or a negative error code from ::cpp_core::StatusCode
+     * if the call itself failed.
+     */
+    MODULE_API auto serialReadMany(cpp_core::ReadManyEntry *entries, int entry_count, int timeout_ms,
+                                   ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
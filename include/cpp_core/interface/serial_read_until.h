@@ -15,6 +15,9 @@ extern "C"
      * byte pointed to by @p until_char has been received. The terminator is part
      * of the returned data.
      *
+     * Bytes received after the terminator stay in the read-ahead buffer and
+     * are returned by the next read call (see serialRead()).
+     *
      * @param handle Port handle.
      * @param buffer Destination buffer.
      * @param buffer_size Capacity of @p buffer in bytes.
@@ -14,6 +14,9 @@ extern "C"
      * Works like serialReadUntil() but supports an arbitrary terminator string.
      * The terminator is included in the returned data.
      *
+     * Bytes received after the terminator stay in the read-ahead buffer and
+     * are returned by the next read call (see serialRead()).
+     *
      * @param handle Port handle.
      * @param buffer Destination buffer.
      * @param buffer_size Capacity of @p buffer in bytes.
@@ -0,0 +1,33 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Read until a specific byte sequence appears, with a single total time budget.
+     *
+     * Deadline-based variant of serialReadUntilSequence(). The call returns once
+     * the terminating sequence has been received, @p buffer is full or
+     * @p total_timeout_ms has elapsed. If the budget runs out first, the bytes
+     * received so far are returned without the terminator.
+     *
+     * @param handle Port handle.
+     * @param buffer Destination buffer.
+     * @param buffer_size Capacity of @p buffer in bytes.
+     * @param total_timeout_ms Total time budget for the whole call in milliseconds.
+     * @param sequence Pointer to the terminating byte sequence (must not be `nullptr`).
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return Bytes read (including the terminator if it arrived in time), 0 if nothing arrived or a negative error
+     * code from ::cpp_core::StatusCode on error.
+     */
+    MODULE_API auto serialReadUntilSequenceFor(int64_t handle, void *buffer, int buffer_size, int total_timeout_ms,
+                                               void *sequence, ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,36 @@
+#pragma once
+#include "../error_callback.h"
+#include "../io_vec.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Read raw bytes from the serial port into several buffers at once (scatter read).
+     *
+     * Buffers are filled in array order: a buffer is only written after every
+     * preceding buffer is full. Timeout handling is identical to serialRead(),
+     * with the combined capacity of all descriptors acting as `buffer_size`.
+     *
+     * @param handle Port handle.
+     * @param buffers Array of @p buffer_count descriptors (must not be `nullptr`). Each entry with `size > 0` must
+     * point to writable memory.
+     * @param buffer_count Number of descriptors in @p buffers (1-1024).
+     * @param timeout_ms Base timeout per byte in milliseconds (applied to the first byte as-is; subsequent bytes use
+     * `timeout_ms * multiplier`).
+     * @param multiplier Factor applied to @p timeout_ms for every byte after the first. 0 -> return immediately after
+     * the first byte.
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return Total bytes read across all buffers (0 on timeout) or a negative error code from ::cpp_core::StatusCode
+     * on error.
+     */
+    MODULE_API auto serialReadV(int64_t handle, const cpp_core::IoVec *buffers, int buffer_count, int timeout_ms,
+                                int multiplier, ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,47 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    namespace cpp_core
+    {
+    struct QueueCompletion
+    {
+        uint64_t user_data;
+        int64_t handle;
+        int op;
+        int result;
+    };
+    } // namespace cpp_core
+
+    /**
+     * @brief Collect finished operations queued with serialSubmit().
+     *
+     * Waits for at most @p timeout_ms milliseconds until at least
+     * @p min_complete operations have finished, then copies up to @p capacity
+     * completions into @p out. `result` holds what the equivalent blocking call
+     * would have returned: a byte count or a negative ::cpp_core::StatusCode.
+     *
+     * Completions are delivered once. Their order matches completion order,
+     * which is only guaranteed to match submission order per handle and
+     * direction.
+     *
+     * @param out Destination array for completions (must not be `nullptr`).
+     * @param capacity Number of entries @p out can hold (> 0).
+     * @param min_complete Number of completions to wait for (0 -> never wait, clamped to @p capacity).
+     * @param timeout_ms Maximum time to wait in milliseconds. Negative -> wait without limit.
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return Number of completions written to @p out (may be fewer than @p min_complete on timeout) or a negative
+     * error code from ::cpp_core::StatusCode on error.
+     */
+    MODULE_API auto serialReap(cpp_core::QueueCompletion *out, int capacity, int min_complete, int timeout_ms,
+                               ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,56 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Borrow received bytes directly from the handle's receive ring (zero-copy read).
+     *
+     * Every handle owns a receive ring that the binding fills in the background.
+     * Instead of copying into a caller buffer like serialRead(), this call hands
+     * out a pointer into that ring. The bytes stay owned by the binding and must
+     * be returned with serialRxRelease() before the next acquisition.
+     *
+     * Contract:
+     * - The call blocks for at most @p timeout_ms milliseconds until at least one
+     *   byte is available. There is no per-byte multiplier.
+     * - Only one contiguous region is returned. If the pending data wraps around
+     *   the end of the ring, the region ends at the ring boundary; the wrapped
+     *   remainder is returned by the next acquisition after serialRxRelease().
+     * - At most one acquisition may be outstanding per handle. Acquiring again
+     *   before releasing fails with ::cpp_core::StatusCode::Io::kBufferError.
+     * - The binding never overwrites acquired bytes. The pointer stays valid until
+     *   serialRxRelease(), serialClearBufferIn() or serialClose() on this handle.
+     * - serialRead() and the other copying read calls consume from the same ring.
+     *   While an acquisition is outstanding they fail with
+     *   ::cpp_core::StatusCode::Io::kBufferError.
+     * - serialClearBufferIn() discards the ring contents and ends an outstanding
+     *   acquisition; the pointer must not be dereferenced afterwards.
+     * - serialAbortRead() makes a blocked acquisition return
+     *   ::cpp_core::StatusCode::Io::kAbortReadError. An already outstanding
+     *   acquisition is not affected.
+     * - serialInBytesWaiting() includes every byte in the ring, acquired or not.
+     * - The ring doubles as the handle's read-ahead buffer: surplus bytes kept by
+     *   delimiter reads and bytes pulled in by serialPeek() live here.
+     *
+     * @param handle Port handle.
+     * @param[out] data Receives a pointer to the first readable byte (must not be `nullptr`). Set to `nullptr` on
+     * timeout or error.
+     * @param[out] size Receives the length of the returned region in bytes (must not be `nullptr`). Set to 0 on
+     * timeout or error.
+     * @param timeout_ms Maximum time to wait for the first byte in milliseconds. 0 -> return immediately.
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return Length of the acquired region (0 on timeout) or a negative error code from ::cpp_core::StatusCode on
+     * error.
+     */
+    MODULE_API auto serialRxAcquire(int64_t handle, const void **data, int *size, int timeout_ms,
+                                    ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
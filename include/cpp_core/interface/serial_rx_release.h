@@ -0,0 +1,36 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Return a region obtained from serialRxAcquire() to the receive ring.
+     *
+     * The first @p consumed bytes of the acquired region are removed from the
+     * ring. Any remaining bytes stay queued and are handed out again by the next
+     * serialRxAcquire() or copying read call. After this call the pointer from
+     * serialRxAcquire() must no longer be used.
+     *
+     * If serialClearBufferIn() ended the acquisition, the first release after it
+     * is a no-op that returns 0 whatever @p consumed is; the bytes are already
+     * gone. Any other release without an outstanding acquisition, including a
+     * second release after the clear, fails with
+     * ::cpp_core::StatusCode::Io::kBufferError.
+     *
+     * @param handle Port handle.
+     * @param consumed Number of bytes to consume, from 0 up to the size returned by serialRxAcquire().
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return 0 on success or a negative error code from ::cpp_core::StatusCode on error
+     * (::cpp_core::StatusCode::Io::kBufferError if no acquisition is outstanding, other than the release
+     * right after a clear described above, or if @p consumed is out of range).
+     */
+    MODULE_API auto serialRxRelease(int64_t handle, int consumed, ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
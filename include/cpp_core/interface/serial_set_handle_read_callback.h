@@ -0,0 +1,42 @@
+#pragma once
+#include "../data_callback.h"
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Register a per-handle callback that receives incoming bytes directly.
+     *
+     * Unlike the process-global serialSetReadCallback(), the callback is bound to
+     * one handle and receives the handle, the bytes that have just arrived and
+     * the caller's @p user_data, so no global lookup or extra serialRead() round
+     * trip is needed.
+     *
+     * Contract:
+     * - The callback runs on a binding-owned thread. @p data is only valid for
+     *   the duration of the call; copy what you need to keep.
+     * - Bytes delivered to the callback are consumed: they are not returned by
+     *   serialRead() or any other read call afterwards.
+     * - The callback must not block and must not call serialClose() or
+     *   serialSetHandleReadCallback() for the same handle.
+     * - Passing `nullptr` unregisters. Once this call returns, the previous
+     *   callback is no longer running and will not be invoked again.
+     * - The global serialSetReadCallback() notification still fires.
+     *
+     * @param handle Port handle.
+     * @param callback_fn Callback receiving `(handle, data, size, user_data)` or `nullptr` to unregister.
+     * @param user_data Opaque pointer passed back unchanged to @p callback_fn. May be `nullptr`.
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return 0 on success or a negative error code from ::cpp_core::StatusCode on error.
+     */
+    MODULE_API auto serialSetHandleReadCallback(int64_t handle, DataCallbackT callback_fn, void *user_data,
+                                                ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,35 @@
+#pragma once
+#include "../data_callback.h"
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Register a per-handle callback that is invoked whenever bytes have been written.
+     *
+     * The callback receives the handle, a pointer to the bytes that were just
+     * handed to the driver and the caller's @p user_data. It is invoked on the
+     * thread that performed the write, before the write call returns. @p data
+     * is only valid for the duration of the call.
+     *
+     * The same restrictions as for serialSetHandleReadCallback() apply: no
+     * blocking, no serialClose() and no re-registration for the same handle from
+     * within the callback. Passing `nullptr` unregisters.
+     *
+     * @param handle Port handle.
+     * @param callback_fn Callback receiving `(handle, data, size, user_data)` or `nullptr` to unregister.
+     * @param user_data Opaque pointer passed back unchanged to @p callback_fn. May be `nullptr`.
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return 0 on success or a negative error code from ::cpp_core::StatusCode on error.
+     */
+    MODULE_API auto serialSetHandleWriteCallback(int64_t handle, DataCallbackT callback_fn, void *user_data,
+                                                 ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
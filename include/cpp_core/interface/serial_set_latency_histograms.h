@@ -0,0 +1,30 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Turn per-handle call-latency histograms on or off.
+     *
+     * Disabled by default. While enabled, every handle opened afterwards records how long each
+     * read, delimiter read, write, drain and open call took (see serialGetLatencyHistogram()), and
+     * the binding-wide histograms record every handle's calls plus close. Recording is a few relaxed
+     * atomic increments per call and never takes a lock.
+     *
+     * Disabling stops recording but keeps what was recorded; a handle's histograms are freed when
+     * it is closed.
+     *
+     * @param enabled Non-zero to enable, 0 to disable.
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return 0 on success or a negative error code from ::cpp_core::StatusCode on error.
+     */
+    MODULE_API auto serialSetLatencyHistograms(int enabled, ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,32 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Enable and size the warm-reopen handle pool.
+     *
+     * While enabled, serialClose() does not close the device: it discards pending input
+     * (serialClearBufferIn() semantics) and parks the still-configured handle, keyed by port path and
+     * the handle's current line settings. A later serialOpen() with the same path and settings returns
+     * a parked handle immediately instead of reopening and reconfiguring the device.
+     *
+     * When more than @p max_idle handles are parked, the oldest is closed. Handles parked longer than
+     * @p idle_timeout_ms are closed on the next pool operation. Pooling is disabled by default.
+     *
+     * @param max_idle Maximum number of parked handles (>= 0). 0 disables pooling and closes all parked handles.
+     * @param idle_timeout_ms Time after which a parked handle is closed (>= 0). 0 -> parked handles never expire.
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return 0 on success or a negative error code from ::cpp_core::StatusCode on error.
+     */
+    MODULE_API auto serialSetPoolOptions(int max_idle, int idle_timeout_ms, ErrorCallbackT error_callback = nullptr)
+        -> int;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,30 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Start or stop recording exported calls into the per-thread trace rings.
+     *
+     * Disabled by default. While enabled, every traced call appends one fixed-size record
+     * (start time, duration, handle, function, size, status) to a ring owned by the calling thread;
+     * each ring keeps its most recent 4096 records.
+     * Turning tracing on discards earlier records. Export them with serialTraceDump().
+     *
+     * Independently of this switch, bindings built with `<sys/sdt.h>` expose the USDT probes
+     * `cpp_core:call_entry(name, handle)` and `cpp_core:call_return(name, handle, result)`.
+     *
+     * @param enabled Non-zero to enable, 0 to disable.
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return 0 on success or a negative error code from ::cpp_core::StatusCode on error.
+     */
+    MODULE_API auto serialSetTracing(int enabled, ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
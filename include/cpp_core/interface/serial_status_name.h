@@ -0,0 +1,24 @@
+#pragma once
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Name of a status code, e.g. "ReadError" for -300.
+     *
+     * Served from a dense table generated at compile time from ::cpp_core::StatusCode (see
+     * status_table.hpp), so the call is an O(1) index without allocation or string building and is
+     * safe to use on error-logging hot paths. The returned string has static storage duration.
+     *
+     * @param code Any value returned by a cpp_core function (0 or a negative ::cpp_core::StatusCode).
+     * @return NUL-terminated code name, "Success" for 0, or "Unknown" for values that are not a status code.
+     */
+    MODULE_API auto serialStatusName(int64_t code) -> const char *;
+
+#ifdef __cplusplus
+}
+#endif
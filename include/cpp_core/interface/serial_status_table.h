@@ -0,0 +1,42 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    namespace cpp_core
+    {
+    struct StatusInfo
+    {
+        int64_t code;
+        const char *name;
+        const char *category;
+    };
+    } // namespace cpp_core
+
+    /**
+     * @brief Copy the full status-code table so hosts can build their own lookup once at startup.
+     *
+     * Entries are `{code, name, category}` for ::cpp_core::StatusCode::kSuccess followed by every
+     * category in declaration order. The table is generated at compile time from ::cpp_core::StatusCode,
+     * so it never goes stale against the codes the library actually returns. `name` and `category`
+     * point to strings with static storage duration.
+     *
+     * Pass @p out = `nullptr` and @p capacity = 0 to query the number of entries.
+     *
+     * @param[out] out Destination array of at least @p capacity entries. May be `nullptr` if @p capacity is 0.
+     * @param capacity Number of entries @p out can hold (>= 0).
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return Total number of status codes (may exceed @p capacity; only the first @p capacity entries are
+     * written) or a negative error code from ::cpp_core::StatusCode on error.
+     */
+    MODULE_API auto serialStatusTable(cpp_core::StatusInfo *out, int capacity, ErrorCallbackT error_callback = nullptr)
+        -> int;
+
+#ifdef __cplusplus
+}
+#endif
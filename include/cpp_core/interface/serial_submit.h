@@ -0,0 +1,68 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    namespace cpp_core
+    {
+    struct QueueSubmission
+    {
+        uint64_t user_data;
+        int64_t handle;
+        int op;
+        int timeout_ms;
+        int multiplier;
+        int buffer_size;
+        void *buffer;
+        const void *sequence;
+        int sequence_size;
+    };
+    } // namespace cpp_core
+
+    /**
+     * @brief Queue asynchronous operations without blocking the calling thread.
+     *
+     * Each entry describes one operation that would otherwise be a blocking
+     * call. The binding executes it in the background and posts a
+     * ::cpp_core::QueueCompletion carrying the same `user_data` cookie to the
+     * process-wide completion queue, which is drained with serialReap().
+     *
+     * | `op` | Equivalent call            | Fields used                                         |
+     * |------|----------------------------|-----------------------------------------------------|
+     * | 0    | serialRead()               | buffer, buffer_size, timeout_ms, multiplier         |
+     * | 1    | serialWrite()              | buffer, buffer_size, timeout_ms, multiplier         |
+     * | 2    | serialDrain()              | -                                                   |
+     * | 3    | serialReadLine()           | buffer, buffer_size, timeout_ms, multiplier         |
+     * | 4    | serialReadUntil()          | as 3, plus `sequence` pointing to one byte          |
+     * | 5    | serialReadUntilSequence()  | as 3, plus `sequence` / `sequence_size`             |
+     *
+     * Contract:
+     * - `buffer` and `sequence` must stay valid until the completion is reaped.
+     * - Operations of the same direction on the same handle run in submission
+     *   order; reads and writes on one handle may overlap.
+     * - The queue depth is binding-defined. If it is full, fewer entries than
+     *   @p entry_count are accepted; resubmit the rest after reaping.
+     * - serialAbortRead() completes every queued or running read-type operation
+     *   on the handle with ::cpp_core::StatusCode::Io::kAbortReadError, and
+     *   serialAbortWrite() completes write and drain operations with
+     *   ::cpp_core::StatusCode::Io::kAbortWriteError. serialClose() does both.
+     * - An entry that is invalid (bad handle, op or buffer) is still accepted and
+     *   completes immediately with the matching negative status code.
+     *
+     * @param entries Array of @p entry_count submissions (must not be `nullptr`). Copied before the call returns.
+     * @param entry_count Number of submissions (> 0).
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return Number of accepted entries (taken from the front of @p entries) or a negative error code from
+     * ::cpp_core::StatusCode on error.
+     */
+    MODULE_API auto serialSubmit(const cpp_core::QueueSubmission *entries, int entry_count,
+                                 ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
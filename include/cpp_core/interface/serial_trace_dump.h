@@ -0,0 +1,28 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Write the recorded calls to a file as Chrome trace-event JSON.
+     *
+     * Exports every record still held in the trace rings (see serialSetTracing()), ordered by start
+     * time, as complete ("X") events with one track per thread. The file opens directly in
+     * chrome://tracing and ui.perfetto.dev. Each event's `args` carry the handle, the call's
+     * non-negative result as `size` and the status name. Recording may continue while dumping; the
+     * rings are not cleared.
+     *
+     * @param path Destination file, created or truncated (must not be `nullptr`).
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return Number of events written or a negative error code from ::cpp_core::StatusCode on error.
+     */
+    MODULE_API auto serialTraceDump(const char *path, ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
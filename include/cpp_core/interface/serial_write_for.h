@@ -0,0 +1,31 @@
+#pragma once
+#include "../error_callback.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Write raw bytes with a single total time budget.
+     *
+     * Deadline-based variant of serialWrite(). The call returns once every byte
+     * has been handed to the driver or @p total_timeout_ms has elapsed,
+     * whichever comes first.
+     *
+     * @param handle Port handle.
+     * @param buffer Data to transmit (must not be `nullptr`).
+     * @param buffer_size Number of bytes in @p buffer (> 0).
+     * @param total_timeout_ms Total time budget for the whole call in milliseconds.
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return Bytes written before the budget elapsed (may be 0) or a negative error code from ::cpp_core::StatusCode
+     * on error.
+     */
+    MODULE_API auto serialWriteFor(int64_t handle, const void *buffer, int buffer_size, int total_timeout_ms,
+                                   ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,34 @@
+#pragma once
+#include "../error_callback.h"
+#include "../io_vec.h"
+#include "../module_api.h"
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Write several buffers to the serial port in one call (gather write).
+     *
+     * The buffers are transmitted back-to-back in array order as if they had
+     * been concatenated, so a frame made of header, payload and checksum can be
+     * sent without a staging copy. Timeout handling mirrors serialWrite(), with
+     * the combined size of all descriptors acting as `buffer_size`.
+     *
+     * @param handle Port handle.
+     * @param buffers Array of @p buffer_count descriptors (must not be `nullptr`). The referenced memory is only read.
+     * @param buffer_count Number of descriptors in @p buffers (1-1024).
+     * @param timeout_ms Base timeout per byte in milliseconds (applied to the first byte as-is; subsequent bytes use
+     * `timeout_ms * multiplier`).
+     * @param multiplier Factor applied to the timeout for subsequent bytes.
+     * @param error_callback [optional] Callback to invoke on error. Defined in error_callback.h. Default is `nullptr`.
+     * @return Total bytes written (may be 0 on timeout) or a negative error code from ::cpp_core::StatusCode on error.
+     */
+    MODULE_API auto serialWriteV(int64_t handle, const cpp_core::IoVec *buffers, int buffer_count, int timeout_ms,
+                                 int multiplier, ErrorCallbackT error_callback = nullptr) -> int;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,26 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    namespace cpp_core
+    {
+    /**
+     * @brief Plain-C buffer descriptor for the scatter/gather calls serialReadV() and serialWriteV().
+     *
+     * Mirrors POSIX `struct iovec` so bindings can forward an array of descriptors
+     * to `readv`/`writev` without translation. @p data is non-const so one
+     * descriptor type serves both directions; serialWriteV() never writes through it.
+     */
+    struct IoVec
+    {
+        void *data;
+        int size;
+    };
+    } // namespace cpp_core
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
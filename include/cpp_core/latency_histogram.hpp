@@ -0,0 +1,158 @@
+#pragma once
+
+#include "interface/serial_get_latency_histogram.h"
+#include "strong_types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace cpp_core
+{
+
+/**
+ * Log-linear call-latency histogram behind serialGetLatencyHistogram().
+ * Latencies below kSubBuckets ns get one bucket each; above that every power of two is split into
+ * kSubBuckets equal buckets, so a bucket is at most 1 / kSubBuckets (12.5 %) of its value wide. The
+ * last bucket collects everything from 2^(kMaxOctave + 1) ns (about 137 s) up. Recording is one relaxed
+ * increment, so it is safe from any thread and never takes a lock:
+ *   const auto start = std::chrono::steady_clock::now();
+ *   const int result = readImpl(...);
+ *   handle.latency->of(LatencyOp::kRead).record(std::chrono::steady_clock::now() - start);
+ */
+class LatencyHistogram
+{
+  public:
+    static constexpr std::size_t kSubBucketBits = 3;
+    static constexpr std::size_t kSubBuckets = std::size_t{1} << kSubBucketBits;
+    static constexpr std::size_t kMaxOctave = 36;
+    static constexpr std::size_t kBucketCount = (kMaxOctave - kSubBucketBits + 2) * kSubBuckets + 1;
+
+    [[nodiscard]] static constexpr auto bucketIndex(std::int64_t ns) noexcept -> std::size_t
+    {
+        const auto value = static_cast<std::uint64_t>(std::max<std::int64_t>(ns, 0));
+        if (value < kSubBuckets)
+        {
+            return static_cast<std::size_t>(value);
+        }
+        const auto octave = static_cast<std::size_t>(std::bit_width(value)) - 1;
+        if (octave > kMaxOctave)
+        {
+            return kBucketCount - 1;
+        }
+        const auto shift = octave - kSubBucketBits;
+        const auto sub = static_cast<std::size_t>(value >> shift) & (kSubBuckets - 1);
+        return (octave - kSubBucketBits + 1) * kSubBuckets + sub;
+    }
+
+    // Largest latency counted in bucket @p index; INT64_MAX for the last one.
+    [[nodiscard]] static constexpr auto bucketUpperNs(std::size_t index) noexcept -> std::int64_t
+    {
+        if (index >= kBucketCount - 1)
+        {
+            return std::numeric_limits<std::int64_t>::max();
+        }
+        if (index < kSubBuckets)
+        {
+            return static_cast<std::int64_t>(index);
+        }
+        const auto shift = index / kSubBuckets - 1;
+        const auto sub = index % kSubBuckets;
+        return static_cast<std::int64_t>(((kSubBuckets + sub + 1) << shift) - 1);
+    }
+
+    auto record(std::chrono::nanoseconds latency) noexcept -> void
+    {
+        counts_[bucketIndex(latency.count())].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Copy the first min(out.size(), kBucketCount) buckets; returns kBucketCount.
+    auto snapshot(std::span<LatencyBucket> out) const noexcept -> std::size_t
+    {
+        const auto count = std::min(out.size(), kBucketCount);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            out[i] = LatencyBucket{bucketUpperNs(i), counts_[i].load(std::memory_order_relaxed)};
+        }
+        return kBucketCount;
+    }
+
+  private:
+    std::array<std::atomic<std::int64_t>, kBucketCount> counts_{};
+};
+
+// One LatencyHistogram per LatencyOp; a binding keeps one set per handle plus one binding-wide set.
+class LatencyHistograms
+{
+  public:
+    static constexpr std::size_t kOpCount = static_cast<std::size_t>(LatencyOp::kClose) + 1;
+
+    [[nodiscard]] static constexpr auto isOp(int op) noexcept -> bool
+    {
+        return op >= 0 && static_cast<std::size_t>(op) < kOpCount;
+    }
+
+    [[nodiscard]] auto of(LatencyOp op) noexcept -> LatencyHistogram &
+    {
+        return histograms_[static_cast<std::size_t>(op)];
+    }
+
+    [[nodiscard]] auto of(LatencyOp op) const noexcept -> const LatencyHistogram &
+    {
+        return histograms_[static_cast<std::size_t>(op)];
+    }
+
+  private:
+    std::array<LatencyHistogram, kOpCount> histograms_{};
+};
+
+/**
+ * Times its own scope into a handle's histograms and the binding-wide ones. Either may be nullptr
+ * (histograms disabled); with both null the clock is never read.
+ *   const LatencyTimer timer(LatencyOp::kDrain, handle.latency.get(), enabled ? &all_latency : nullptr);
+ */
+class LatencyTimer
+{
+  public:
+    LatencyTimer(LatencyOp op, LatencyHistograms *handle, LatencyHistograms *aggregate) noexcept
+        : op_(op), handle_(handle), aggregate_(aggregate)
+    {
+        if (handle_ != nullptr || aggregate_ != nullptr)
+        {
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    LatencyTimer(const LatencyTimer &) = delete;
+    auto operator=(const LatencyTimer &) -> LatencyTimer & = delete;
+
+    ~LatencyTimer()
+    {
+        if (handle_ == nullptr && aggregate_ == nullptr)
+        {
+            return;
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start_;
+        for (auto *histograms : {handle_, aggregate_})
+        {
+            if (histograms != nullptr)
+            {
+                histograms->of(op_).record(elapsed);
+            }
+        }
+    }
+
+  private:
+    LatencyOp op_;
+    LatencyHistograms *handle_;
+    LatencyHistograms *aggregate_;
+    std::chrono::steady_clock::time_point start_{};
+};
+
+} // namespace cpp_core
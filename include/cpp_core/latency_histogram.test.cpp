@@ -0,0 +1,53 @@
+#include "cpp_core/latency_histogram.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace cpp_core::tests::latency_histogram
+{
+
+using H = LatencyHistogram;
+
+static_assert(H::kBucketCount == 281);
+static_assert(H::bucketIndex(-5) == 0);
+static_assert(H::bucketIndex(7) == 7 && H::bucketIndex(8) == 8 && H::bucketIndex(15) == 15);
+static_assert(H::bucketIndex(16) == 16 && H::bucketIndex(17) == 16 && H::bucketIndex(18) == 17);
+static_assert(H::bucketIndex(std::numeric_limits<std::int64_t>::max()) == H::kBucketCount - 1);
+static_assert(H::bucketUpperNs(H::kBucketCount - 1) == std::numeric_limits<std::int64_t>::max());
+
+// Every bucket's upper bound maps back to it and the next value starts the next bucket.
+consteval auto bucketsAreContiguous() -> bool
+{
+    for (std::size_t index = 0; index + 1 < H::kBucketCount; ++index)
+    {
+        const auto upper = H::bucketUpperNs(index);
+        if (H::bucketIndex(upper) != index || H::bucketIndex(upper + 1) != index + 1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// No bucket is wider than 1 / kSubBuckets of the smallest value it holds.
+consteval auto relativeWidthIsBounded() -> bool
+{
+    for (std::size_t index = H::kSubBuckets + 1; index + 1 < H::kBucketCount; ++index)
+    {
+        const auto lower = H::bucketUpperNs(index - 1) + 1;
+        const auto width = H::bucketUpperNs(index) - lower + 1;
+        if (width * static_cast<std::int64_t>(H::kSubBuckets) > lower)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(bucketsAreContiguous());
+static_assert(relativeWidthIsBounded());
+static_assert(LatencyHistograms::isOp(0) && LatencyHistograms::isOp(5) && !LatencyHistograms::isOp(6));
+static_assert(!LatencyHistograms::isOp(-1));
+
+} // namespace cpp_core::tests::latency_histogram
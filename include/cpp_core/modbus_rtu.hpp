@@ -0,0 +1,233 @@
+#pragma once
+
+#include "crc.hpp"
+#include "result.hpp"
+#include "serial_config.hpp"
+#include "status_code.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace cpp_core
+{
+
+// Address + function + CRC-16.
+inline constexpr std::size_t kRtuMinAduSize = 4;
+// Modbus over serial line: 1 address + 253 PDU + 2 CRC.
+inline constexpr std::size_t kRtuMaxAduSize = 256;
+inline constexpr std::uint8_t kRtuBroadcastAddress = 0;
+
+/**
+ * Modbus RTU silent intervals for a serial line (Modbus over Serial Line V1.02, 2.5.1.1).
+ * Derived from the real character length (start + data + parity + stop bits) instead of a fixed
+ * 11-bit assumption; above 19200 baud the spec's fixed 750 us / 1750 us apply.
+ *   constexpr auto kTiming = RtuTiming::from(SerialConfig::make<9600, 8, Parity::kEven>());
+ */
+struct RtuTiming
+{
+    std::chrono::microseconds character;
+    std::chrono::microseconds t15;
+    std::chrono::microseconds t35;
+
+    [[nodiscard]] static constexpr auto from(const SerialConfig &config) noexcept -> RtuTiming
+    {
+        const std::int64_t bits = 1 + config.data_bits + (config.parity == Parity::kNone ? 0 : 1)
+                                  + (config.stop_bits == StopBits::kTwo ? 2 : 1);
+        // ceil(halves / 2 * bits / baud) in microseconds, so t1.5 and t3.5 stay exact.
+        const auto half_characters = [&](std::int64_t halves) {
+            const auto denominator = 2 * static_cast<std::int64_t>(config.baudrate);
+            return std::chrono::microseconds{(halves * bits * 1'000'000 + denominator - 1) / denominator};
+        };
+        if (config.baudrate > 19200)
+        {
+            return {.character = half_characters(2),
+                    .t15 = std::chrono::microseconds{750},
+                    .t35 = std::chrono::microseconds{1750}};
+        }
+        return {.character = half_characters(2), .t15 = half_characters(3), .t35 = half_characters(7)};
+    }
+
+    // serialRead() timeout whose expiry proves a t3.5 gap: t3.5 rounded up to whole milliseconds.
+    [[nodiscard]] constexpr auto interFrameTimeoutMs() const noexcept -> int
+    {
+        return static_cast<int>(std::chrono::ceil<std::chrono::milliseconds>(t35).count());
+    }
+};
+
+// Zero-copy view of a validated RTU frame; `data` points into the caller's receive buffer.
+struct RtuFrame
+{
+    std::uint8_t address;
+    std::uint8_t function;
+    std::span<const std::byte> data;
+
+    // Exception responses set the high bit of the function code; data[0] is the exception code.
+    [[nodiscard]] constexpr auto isException() const noexcept -> bool
+    {
+        return (function & 0x80U) != 0;
+    }
+};
+
+// Validate the CRC-16/MODBUS trailer of @p adu and split it into address, function and data.
+[[nodiscard]] constexpr auto parseRtuFrame(std::span<const std::byte> adu) -> Result<RtuFrame>
+{
+    if (adu.size() < kRtuMinAduSize || adu.size() > kRtuMaxAduSize)
+    {
+        return fail<RtuFrame>(StatusCode::Io::kReadError, "Invalid Modbus RTU frame length");
+    }
+    const auto body = adu.first(adu.size() - 2);
+    const auto received = static_cast<std::uint16_t>(static_cast<unsigned>(adu[adu.size() - 2])
+                                                     | (static_cast<unsigned>(adu[adu.size() - 1]) << 8U));
+    if (Crc16Modbus::compute(body) != received)
+    {
+        return fail<RtuFrame>(StatusCode::Io::kReadError, "Modbus RTU CRC mismatch");
+    }
+    return RtuFrame{
+        .address = static_cast<std::uint8_t>(body[0]),
+        .function = static_cast<std::uint8_t>(body[1]),
+        .data = body.subspan(2),
+    };
+}
+
+// Build an ADU (address, function, @p data, CRC low byte first) in @p out. Returns its size.
+[[nodiscard]] constexpr auto encodeRtuFrame(std::uint8_t address, std::uint8_t function,
+                                            std::span<const std::byte> data, std::span<std::byte> out)
+    -> Result<std::size_t>
+{
+    const auto size = data.size() + kRtuMinAduSize;
+    if (size > kRtuMaxAduSize || size > out.size())
+    {
+        return fail<std::size_t>(StatusCode::Io::kBufferError, "Modbus RTU frame does not fit");
+    }
+    out[0] = static_cast<std::byte>(address);
+    out[1] = static_cast<std::byte>(function);
+    std::ranges::copy(data, out.begin() + 2);
+    const auto crc = Crc16Modbus::compute(out.first(size - 2));
+    out[size - 2] = static_cast<std::byte>(crc & 0xFFU);
+    out[size - 1] = static_cast<std::byte>(crc >> 8U);
+    return size;
+}
+
+/**
+ * Receive one RTU frame with @p read, a callable shaped like serialRead() without the error callback.
+ * Waits up to @p timeout_ms for the first byte, then keeps reading with multiplier 0 and a timeout of
+ * ceil(t3.5) until a read times out: that silence is the end of the frame, so no fixed sleeps are
+ * needed. Returns the ADU size in @p buffer (0 if nothing arrived) for parseRtuFrame().
+ * A frame longer than @p buffer is drained to its end and reported as kBufferError.
+ * Intra-frame t1.5 violations are not detected: serialRead() timeouts have millisecond resolution.
+ */
+template <typename Read>
+requires std::is_invocable_r_v<int, Read, std::int64_t, void *, int, int, int>
+constexpr auto readRtuFrame(Read &&read, std::int64_t handle, const RtuTiming &timing, std::span<std::byte> buffer,
+                            int timeout_ms) -> Result<std::size_t>
+{
+    buffer = buffer.first(std::min(buffer.size(), kRtuMaxAduSize));
+    std::array<std::byte, 64> overflow{};
+    std::size_t received = 0;
+    bool overflowed = false;
+    int wait_ms = timeout_ms;
+    for (;;)
+    {
+        auto target = received < buffer.size() ? buffer.subspan(received) : std::span(overflow);
+        const int count =
+            std::invoke(read, handle, static_cast<void *>(target.data()), static_cast<int>(target.size()), wait_ms, 0);
+        if (count < 0)
+        {
+            return fail<std::size_t>(count);
+        }
+        if (count == 0)
+        {
+            break;
+        }
+        if (received < buffer.size())
+        {
+            received += static_cast<std::size_t>(count);
+        }
+        else
+        {
+            overflowed = true;
+        }
+        wait_ms = timing.interFrameTimeoutMs();
+    }
+    if (overflowed)
+    {
+        return fail<std::size_t>(StatusCode::Io::kBufferError, "Modbus RTU frame exceeds buffer");
+    }
+    return received;
+}
+
+// Send @p adu with @p write (shaped like serialWrite() without the error callback), retrying short writes.
+template <typename Write>
+requires std::is_invocable_r_v<int, Write, std::int64_t, const void *, int, int, int>
+constexpr auto writeRtuFrame(Write &&write, std::int64_t handle, std::span<const std::byte> adu, int timeout_ms)
+    -> Status
+{
+    while (!adu.empty())
+    {
+        const int count = std::invoke(write, handle, static_cast<const void *>(adu.data()),
+                                      static_cast<int>(adu.size()), timeout_ms, 1);
+        if (count < 0)
+        {
+            return fail(count);
+        }
+        if (count == 0)
+        {
+            return fail(StatusCode::Io::kWriteError, "Modbus RTU write timed out");
+        }
+        adu = adu.subspan(static_cast<std::size_t>(count));
+    }
+    return ok();
+}
+
+/**
+ * Master transaction: send @p request, then receive and validate the reply into @p response.
+ * The reply must come from the addressed slave and echo the function code (or its exception form).
+ * Broadcast requests get no reply; they return a frame with the broadcast address and no data.
+ * readRtuFrame() only returns after a t3.5 silence, so back-to-back transactions are correctly spaced.
+ */
+template <typename Read, typename Write>
+requires std::is_invocable_r_v<int, Read, std::int64_t, void *, int, int, int>
+         && std::is_invocable_r_v<int, Write, std::int64_t, const void *, int, int, int>
+constexpr auto transactRtu(Read &&read, Write &&write, std::int64_t handle, const RtuTiming &timing,
+                           std::span<const std::byte> request, std::span<std::byte> response, int timeout_ms)
+    -> Result<RtuFrame>
+{
+    if (request.size() < kRtuMinAduSize)
+    {
+        return fail<RtuFrame>(StatusCode::Io::kBufferError, "Invalid Modbus RTU request");
+    }
+    const auto address = static_cast<std::uint8_t>(request[0]);
+    const auto function = static_cast<std::uint8_t>(request[1]);
+    if (auto sent = writeRtuFrame(std::forward<Write>(write), handle, request, timeout_ms); !sent)
+    {
+        return forwardUnexpected(std::move(sent));
+    }
+    if (address == kRtuBroadcastAddress)
+    {
+        return RtuFrame{.address = address, .function = function, .data = {}};
+    }
+    auto received = readRtuFrame(std::forward<Read>(read), handle, timing, response, timeout_ms);
+    if (!received)
+    {
+        return forwardUnexpected(std::move(received));
+    }
+    if (*received == 0)
+    {
+        return fail<RtuFrame>(StatusCode::Io::kReadError, "Modbus RTU response timed out");
+    }
+    auto frame = parseRtuFrame(std::span<const std::byte>(response).first(*received));
+    if (frame && (frame->address != address || (frame->function & 0x7FU) != function))
+    {
+        return fail<RtuFrame>(StatusCode::Io::kReadError, "Unexpected Modbus RTU response");
+    }
+    return frame;
+}
+
+} // namespace cpp_core
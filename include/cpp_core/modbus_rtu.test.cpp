@@ -0,0 +1,135 @@
+#include "cpp_core/modbus_rtu.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace cpp_core::tests::modbus_rtu
+{
+
+using std::chrono::microseconds;
+
+// 8E1 = 11 bits per character.
+constexpr auto kTiming9600 = RtuTiming::from(SerialConfig::make<9600, 8, Parity::kEven>());
+constexpr auto kTiming19200 = RtuTiming::from(SerialConfig::make<19200, 8, Parity::kNone, StopBits::kTwo>());
+constexpr auto kTiming115200 = RtuTiming::from(SerialConfig::make<115200, 8, Parity::kEven>());
+// 8N1 = 10 bits per character.
+constexpr auto kTiming9600N1 = RtuTiming::from(SerialConfig::make<9600, 8>());
+
+static_assert(kTiming9600.character == microseconds{1146});
+static_assert(kTiming9600.t15 == microseconds{1719});
+static_assert(kTiming9600.t35 == microseconds{4011});
+static_assert(kTiming9600.interFrameTimeoutMs() == 5);
+static_assert(kTiming19200.t35 == microseconds{2006});
+static_assert(kTiming115200.t15 == microseconds{750});
+static_assert(kTiming115200.t35 == microseconds{1750});
+static_assert(kTiming115200.interFrameTimeoutMs() == 2);
+static_assert(kTiming9600N1.t35 == microseconds{3646});
+
+// Read holding registers request from the Modbus application protocol spec (slave 0x11, 3 registers at 0x006B).
+constexpr std::array kRequestData{std::byte{0x00}, std::byte{0x6B}, std::byte{0x00}, std::byte{0x03}};
+constexpr std::array kRequestAdu{std::byte{0x11}, std::byte{0x03}, std::byte{0x00}, std::byte{0x6B},
+                                 std::byte{0x00}, std::byte{0x03}, std::byte{0x76}, std::byte{0x87}};
+
+consteval auto encodesKnownRequest() -> bool
+{
+    std::array<std::byte, kRtuMaxAduSize> out{};
+    const auto size = encodeRtuFrame(0x11, 0x03, kRequestData, out);
+    return size && *size == kRequestAdu.size() && std::ranges::equal(std::span(out).first(*size), kRequestAdu);
+}
+
+consteval auto parsesWithoutCopying() -> bool
+{
+    const auto frame = parseRtuFrame(kRequestAdu);
+    return frame && frame->address == 0x11 && frame->function == 0x03 && frame->data.size() == 4
+           && frame->data.data() == kRequestAdu.data() + 2 && !frame->isException();
+}
+
+consteval auto rejectsCorruptFrames() -> bool
+{
+    auto corrupt = kRequestAdu;
+    corrupt[3] = std::byte{0x6C};
+    const auto bad_crc = parseRtuFrame(corrupt);
+    const auto too_short = parseRtuFrame(std::span(kRequestAdu).first(3));
+    std::array<std::byte, 5> small{};
+    const auto no_room = encodeRtuFrame(0x11, 0x03, kRequestData, small);
+    return !bad_crc && bad_crc.error() == StatusCode::Io::kReadError && !too_short && !no_room
+           && no_room.error() == StatusCode::Io::kBufferError;
+}
+
+// Scripted serialRead(): delivers the next chunk per call, then times out; records the timeouts used.
+struct FakeLine
+{
+    std::span<const std::byte> stream;
+    std::array<std::size_t, 4> chunks;
+    std::size_t call = 0;
+    std::size_t offset = 0;
+    std::array<int, 8> timeouts{};
+
+    constexpr auto operator()(std::int64_t, void *buffer, int size, int timeout_ms, int multiplier) -> int
+    {
+        timeouts[call] = multiplier == 0 ? timeout_ms : -1;
+        const auto chunk = call < chunks.size() ? chunks[call] : 0;
+        ++call;
+        const auto count = std::min({chunk, stream.size() - offset, static_cast<std::size_t>(size)});
+        std::ranges::copy(stream.subspan(offset, count), static_cast<std::byte *>(buffer));
+        offset += count;
+        return static_cast<int>(count);
+    }
+};
+
+consteval auto readStopsAtSilence() -> bool
+{
+    FakeLine line{.stream = kRequestAdu, .chunks = {1, 4, 3, 0}};
+    std::array<std::byte, kRtuMaxAduSize> buffer{};
+    const auto size = readRtuFrame(line, 1, kTiming9600, buffer, 100);
+    return size && *size == 8 && line.call == 4 && line.timeouts[0] == 100 && line.timeouts[1] == 5
+           && line.timeouts[3] == 5 && parseRtuFrame(std::span(buffer).first(*size)).has_value();
+}
+
+consteval auto readReportsTimeoutAsEmpty() -> bool
+{
+    FakeLine line{.stream = kRequestAdu, .chunks = {0, 0, 0, 0}};
+    std::array<std::byte, kRtuMaxAduSize> buffer{};
+    const auto size = readRtuFrame(line, 1, kTiming9600, buffer, 100);
+    return size && *size == 0 && line.call == 1;
+}
+
+consteval auto readDrainsOversizedFrame() -> bool
+{
+    FakeLine line{.stream = kRequestAdu, .chunks = {4, 4, 4, 0}};
+    std::array<std::byte, 5> buffer{};
+    const auto size = readRtuFrame(line, 1, kTiming9600, buffer, 100);
+    return !size && size.error() == StatusCode::Io::kBufferError && line.offset == kRequestAdu.size();
+}
+
+consteval auto transactionMatchesReply() -> bool
+{
+    // Reply: slave 0x11, function 0x03, 2 data bytes.
+    std::array<std::byte, 8> reply_adu{};
+    const std::array reply_data{std::byte{0x02}, std::byte{0x00}};
+    const auto reply_size = *encodeRtuFrame(0x11, 0x03, reply_data, reply_adu);
+    FakeLine line{.stream = std::span(reply_adu).first(reply_size), .chunks = {2, 8, 0, 0}};
+    int written = 0;
+    const auto write = [&written](std::int64_t, const void *, int size, int, int) {
+        const auto chunk = std::min(size, 3);
+        written += chunk;
+        return chunk;
+    };
+    std::array<std::byte, kRtuMaxAduSize> response{};
+    const auto frame = transactRtu(line, write, 1, kTiming9600, kRequestAdu, response, 100);
+    return frame && written == 8 && frame->data.size() == 2 && frame->data[0] == std::byte{0x02};
+}
+
+static_assert(encodesKnownRequest());
+static_assert(parsesWithoutCopying());
+static_assert(rejectsCorruptFrames());
+static_assert(readStopsAtSilence());
+static_assert(readReportsTimeoutAsEmpty());
+static_assert(readDrainsOversizedFrame());
+static_assert(transactionMatchesReply());
+
+} // namespace cpp_core::tests::modbus_rtu
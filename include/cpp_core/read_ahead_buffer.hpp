@@ -0,0 +1,131 @@
+#pragma once
+
+#include "byte_search.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+
+namespace cpp_core
+{
+
+/**
+ * Fixed-capacity per-handle read-ahead buffer for the delimiter reads.
+ * Bindings read large chunks from the OS into writable(), commit() them, and hand out
+ * complete frames via findEnd() + consume(). Surplus bytes stay queued for the next call.
+ *   auto end = buffer.findEnd(terminator);
+ *   while (end == 0 && !buffer.full()) { buffer.commit(::read(fd, ...writable()...)); end = buffer.findEnd(...); }
+ *   buffer.consume(out.first(end));
+ */
+template <std::size_t Capacity> class ReadAheadBuffer
+{
+    static_assert(Capacity > 0, "ReadAheadBuffer capacity must not be 0");
+
+  public:
+    [[nodiscard]] static constexpr auto capacity() noexcept -> std::size_t
+    {
+        return Capacity;
+    }
+
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+    {
+        return tail_ - head_;
+    }
+
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool
+    {
+        return head_ == tail_;
+    }
+
+    [[nodiscard]] constexpr auto full() const noexcept -> bool
+    {
+        return size() == Capacity;
+    }
+
+    // Buffered bytes in arrival order.
+    [[nodiscard]] constexpr auto readable() const noexcept -> std::span<const std::byte>
+    {
+        return std::span<const std::byte>(storage_).subspan(head_, size());
+    }
+
+    // Contiguous free space for the next OS read. Moves buffered bytes to the front first if that frees space.
+    [[nodiscard]] constexpr auto writable() noexcept -> std::span<std::byte>
+    {
+        if (head_ != 0 && tail_ == Capacity)
+        {
+            std::copy(storage_.begin() + static_cast<std::ptrdiff_t>(head_),
+                      storage_.begin() + static_cast<std::ptrdiff_t>(tail_), storage_.begin());
+            tail_ -= head_;
+            head_ = 0;
+        }
+        return std::span<std::byte>(storage_).subspan(tail_);
+    }
+
+    // Mark @p count bytes written into writable() as buffered.
+    constexpr auto commit(std::size_t count) noexcept -> void
+    {
+        tail_ += std::min(count, Capacity - tail_);
+    }
+
+    // Copy up to out.size() bytes without consuming them.
+    constexpr auto peek(std::span<std::byte> out) const noexcept -> std::size_t
+    {
+        const auto count = std::min(out.size(), size());
+        std::copy_n(readable().begin(), count, out.begin());
+        return count;
+    }
+
+    // Copy up to out.size() bytes and remove them from the buffer.
+    constexpr auto consume(std::span<std::byte> out) noexcept -> std::size_t
+    {
+        const auto count = peek(out);
+        discard(count);
+        return count;
+    }
+
+    constexpr auto discard(std::size_t count) noexcept -> void
+    {
+        head_ += std::min(count, size());
+        if (head_ == tail_)
+        {
+            clear();
+        }
+    }
+
+    constexpr auto clear() noexcept -> void
+    {
+        head_ = 0;
+        tail_ = 0;
+    }
+
+    /**
+     * Length of the buffered prefix that ends with @p terminator, or 0 if the terminator has not arrived yet.
+     * @p from is the buffer size a previous call already searched, so a growing buffer is scanned once; the
+     * search backs off terminator.size() - 1 bytes from there to catch a terminator split across commits.
+     */
+    [[nodiscard]] constexpr auto findEnd(std::span<const std::byte> terminator, std::size_t from = 0) const noexcept
+        -> std::size_t
+    {
+        const auto data = readable();
+        if (terminator.empty() || terminator.size() > data.size())
+        {
+            return 0;
+        }
+        const auto backed_off = from - std::min(from, terminator.size() - 1);
+        const auto start = std::min(backed_off, data.size() - terminator.size() + 1);
+        const auto found = findSequence(data.subspan(start), terminator);
+        if (found == kNotFound)
+        {
+            return 0;
+        }
+        return start + found + terminator.size();
+    }
+
+  private:
+    std::array<std::byte, Capacity> storage_{};
+    std::size_t head_{0};
+    std::size_t tail_{0};
+};
+
+} // namespace cpp_core
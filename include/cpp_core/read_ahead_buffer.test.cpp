@@ -0,0 +1,73 @@
+#include "cpp_core/read_ahead_buffer.hpp"
+
+#include <array>
+#include <cstddef>
+#include <span>
+
+namespace cpp_core::tests::read_ahead_buffer
+{
+
+template <std::size_t N> constexpr auto fill(auto &buffer, const char (&text)[N]) -> void
+{
+    auto dst = buffer.writable();
+    for (std::size_t i = 0; i + 1 < N; ++i)
+    {
+        dst[i] = static_cast<std::byte>(text[i]);
+    }
+    buffer.commit(N - 1);
+}
+
+constexpr auto kNewline = std::array{std::byte{'\n'}};
+constexpr auto kCrLf = std::array{std::byte{'\r'}, std::byte{'\n'}};
+
+consteval auto keepsSurplusAfterTerminator() -> bool
+{
+    ReadAheadBuffer<16> buffer;
+    fill(buffer, "ab\ncd\nef");
+    std::array<std::byte, 8> line{};
+    const auto first = buffer.consume(std::span(line).first(buffer.findEnd(kNewline)));
+    const auto second = buffer.findEnd(kNewline);
+    return first == 3 && line[2] == std::byte{'\n'} && second == 3 && buffer.size() == 5;
+}
+
+consteval auto peekDoesNotConsume() -> bool
+{
+    ReadAheadBuffer<8> buffer;
+    fill(buffer, "xyz");
+    std::array<std::byte, 2> out{};
+    return buffer.peek(out) == 2 && buffer.size() == 3 && out[1] == std::byte{'y'};
+}
+
+consteval auto compactsWhenTailIsFull() -> bool
+{
+    ReadAheadBuffer<4> buffer;
+    fill(buffer, "abcd");
+    buffer.discard(3);
+    const auto space = buffer.writable().size();
+    return space == 3 && buffer.readable()[0] == std::byte{'d'};
+}
+
+consteval auto findsSequenceFromOffset() -> bool
+{
+    ReadAheadBuffer<16> buffer;
+    fill(buffer, "OK\r\nERR\r\n");
+    return buffer.findEnd(kCrLf) == 4 && buffer.findEnd(kCrLf, 4) == 9 && buffer.findEnd(kNewline, 9) == 0;
+}
+
+consteval auto findsTerminatorSplitAcrossCommits() -> bool
+{
+    ReadAheadBuffer<16> buffer;
+    fill(buffer, "OK\r");
+    const auto before = buffer.findEnd(kCrLf);
+    fill(buffer, "\n");
+    return before == 0 && buffer.findEnd(kCrLf, 3) == 4;
+}
+
+static_assert(keepsSurplusAfterTerminator());
+static_assert(peekDoesNotConsume());
+static_assert(compactsWhenTailIsFull());
+static_assert(findsSequenceFromOffset());
+static_assert(findsTerminatorSplitAcrossCommits());
+static_assert(ReadAheadBuffer<32>::capacity() == 32);
+
+} // namespace cpp_core::tests::read_ahead_buffer
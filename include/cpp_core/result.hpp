@@ -2,26 +2,87 @@
 
 #include "status_code.h"
 
+#include <algorithm>
+#include <array>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <expected>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 
 namespace cpp_core
 {
 
-// Enriched error type carrying a StatusCode and an optional message.
+/**
+ * Allocation-free error text: either a pointer to a string literal (the common case, checked at
+ * compile time by the consteval constructor) or a copy held in a small inline buffer, so Error and
+ * Result<T> stay a few words wide. Runtime text is truncated to kInlineCapacity characters; callbacks
+ * get up to kErrorMessageBufferSize - 1 through invokeError() / failMsg(), formatted on their stack.
+ *   fail(StatusCode::Io::kReadError, "Read timed out");  // references the literal
+ *   fail(StatusCode::Io::kReadError, runtime_text);      // copies, truncated to kInlineCapacity
+ */
+class ErrorMessage
+{
+  public:
+    static constexpr std::size_t kInlineCapacity = 14;
+
+    constexpr ErrorMessage() noexcept = default;
+
+    consteval ErrorMessage(const char *literal) noexcept : static_text_(literal)
+    {
+    }
+
+    constexpr explicit ErrorMessage(std::string_view text) noexcept
+        : inline_text_{}, inline_size_(static_cast<std::uint8_t>(std::min(text.size(), kInlineCapacity)))
+    {
+        std::copy_n(text.begin(), inline_size_, inline_text_.begin());
+    }
+
+    [[nodiscard]] constexpr auto c_str() const noexcept -> const char *
+    {
+        return isInline() ? inline_text_.data() : static_text_;
+    }
+
+    [[nodiscard]] constexpr auto view() const noexcept -> std::string_view
+    {
+        return isInline() ? std::string_view(inline_text_.data(), inline_size_) : std::string_view(static_text_);
+    }
+
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool
+    {
+        return view().empty();
+    }
+
+  private:
+    static constexpr std::uint8_t kStaticText = 0xFF;
+
+    [[nodiscard]] constexpr auto isInline() const noexcept -> bool
+    {
+        return inline_size_ != kStaticText;
+    }
+
+    union
+    {
+        const char *static_text_ = "";
+        std::array<char, kInlineCapacity + 1> inline_text_;
+    };
+    std::uint8_t inline_size_{kStaticText};
+};
+
+// Enriched error type carrying a StatusCode and an optional message. Never allocates.
 struct Error
 {
     StatusCodeValue code;
-    std::string message;
+    ErrorMessage message;
 
     constexpr explicit Error(StatusCodeValue code_in) noexcept : code(code_in)
     {
     }
 
-    constexpr Error(StatusCodeValue code_in, std::string msg) : code(code_in), message(std::move(msg))
+    constexpr Error(StatusCodeValue code_in, ErrorMessage msg) noexcept : code(code_in), message(msg)
     {
     }
 
@@ -70,9 +131,18 @@ template <typename T = void> [[nodiscard]] constexpr auto fail(StatusCodeValue c
     return std::unexpected(Error{code});
 }
 
-template <typename T = void> [[nodiscard]] constexpr auto fail(StatusCodeValue code, std::string message) -> Result<T>
+template <typename T = void> [[nodiscard]] constexpr auto fail(StatusCodeValue code, ErrorMessage message) -> Result<T>
+{
+    return std::unexpected(Error{code, message});
+}
+
+// Runtime text (std::string or std::string_view) is copied into the message, see ErrorMessage for the limit.
+template <typename T = void, typename Text>
+    requires std::same_as<std::remove_cvref_t<Text>, std::string>
+             || std::same_as<std::remove_cvref_t<Text>, std::string_view>
+[[nodiscard]] constexpr auto fail(StatusCodeValue code, const Text &message) -> Result<T>
 {
-    return std::unexpected(Error{code, std::move(message)});
+    return std::unexpected(Error{code, ErrorMessage{std::string_view{message}}});
 }
 
 // Concept: anything that is a Result<U> for some U
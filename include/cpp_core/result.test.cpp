@@ -1,5 +1,9 @@
 #include "cpp_core/result.hpp"
 
+#include <string>
+#include <string_view>
+#include <type_traits>
+
 namespace cpp_core::tests::result
 {
 
@@ -43,6 +47,21 @@ constexpr auto propagateStatusFailure() -> Status
     return failedStatus().and_then([]() -> Status { return ok(); });
 }
 
+constexpr auto failWithLiteral() -> Result<int>
+{
+    return fail<int>(StatusCode::Io::kReadError, "Read timed out");
+}
+
+constexpr auto failWithRuntimeText(std::string_view text) -> Status
+{
+    return fail(StatusCode::Io::kBufferError, ErrorMessage{text});
+}
+
+constexpr auto failWithString(std::string_view text) -> Result<int>
+{
+    return fail<int>(StatusCode::Io::kBufferError, std::string(text));
+}
+
 static_assert(addOne().has_value());
 static_assert(addOne().value() == 42);
 static_assert(okStatus().has_value());
@@ -51,4 +70,15 @@ static_assert(propagateLeafFailure().error() == StatusCode::Connection::kInvalid
 static_assert(!propagateStatusFailure().has_value());
 static_assert(propagateStatusFailure().error() == StatusCode::Io::kReadError);
 
+// Error stays trivially copyable and small: a literal pointer or a short inline copy, never a heap string.
+static_assert(std::is_trivially_copyable_v<Error>);
+static_assert(sizeof(ErrorMessage) <= 3 * sizeof(void *));
+static_assert(sizeof(Result<int>) <= 5 * sizeof(void *));
+static_assert(failWithLiteral().error().message.view() == "Read timed out");
+static_assert(failWithRuntimeText("short").error().message.view() == "short");
+static_assert(failWithRuntimeText("a runtime message longer than the inline buffer").error().message.view()
+              == "a runtime mess");
+static_assert(failWithString("Port is busy").error().message.view() == "Port is busy");
+static_assert(Error{StatusCode::Io::kReadError}.message.empty());
+
 } // namespace cpp_core::tests::result
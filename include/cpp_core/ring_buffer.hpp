@@ -0,0 +1,159 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <span>
+
+namespace cpp_core
+{
+
+// Destructive interference size used to keep producer and consumer state on separate cache lines.
+inline constexpr std::size_t kCacheLineSize = 64;
+
+/**
+ * Wait-free single-producer / single-consumer byte ring.
+ * Meant for the hand-off between a binding's reader thread and the consumer side of a handle
+ * (serialRead(), serialRxAcquire()). Reservations are contiguous spans, so the producer can pass
+ * prepareWrite() straight to ::read / ReadFile and the consumer can lend prepareRead() out without a copy.
+ *   auto space = ring.prepareWrite();
+ *   ring.commitWrite(::read(fd, space.data(), space.size()));
+ *   ...
+ *   auto data = ring.prepareRead();
+ *   ring.commitRead(decode(data));
+ *
+ * Producer-side members: prepareWrite(), commitWrite(), write().
+ * Consumer-side members: prepareRead(), commitRead(), read(), clear().
+ * size(), empty() and full() may be called from either side and return a snapshot.
+ */
+template <std::size_t Capacity> class RingBuffer
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "RingBuffer capacity must be a power of two");
+
+  public:
+    RingBuffer() = default;
+    RingBuffer(const RingBuffer &) = delete;
+    auto operator=(const RingBuffer &) -> RingBuffer & = delete;
+    RingBuffer(RingBuffer &&) = delete;
+    auto operator=(RingBuffer &&) -> RingBuffer & = delete;
+    ~RingBuffer() = default;
+
+    [[nodiscard]] static constexpr auto capacity() noexcept -> std::size_t
+    {
+        return Capacity;
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    {
+        return write_pos_.load(std::memory_order_acquire) - read_pos_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool
+    {
+        return size() == 0;
+    }
+
+    [[nodiscard]] auto full() const noexcept -> bool
+    {
+        return size() == Capacity;
+    }
+
+    // Producer: contiguous free region, ending at the ring boundary at the latest.
+    [[nodiscard]] auto prepareWrite() noexcept -> std::span<std::byte>
+    {
+        const auto write_pos = write_pos_.load(std::memory_order_relaxed);
+        if (write_pos - cached_read_pos_ == Capacity)
+        {
+            cached_read_pos_ = read_pos_.load(std::memory_order_acquire);
+        }
+        const auto offset = write_pos & kMask;
+        const auto free = Capacity - (write_pos - cached_read_pos_);
+        return std::span<std::byte>(storage_).subspan(offset, std::min(free, Capacity - offset));
+    }
+
+    // Producer: publish @p count bytes written into the last prepareWrite() region.
+    auto commitWrite(std::size_t count) noexcept -> void
+    {
+        write_pos_.store(write_pos_.load(std::memory_order_relaxed) + count, std::memory_order_release);
+    }
+
+    // Producer: copy as much of @p data as fits, wrapping around the ring end. Returns bytes written.
+    auto write(std::span<const std::byte> data) noexcept -> std::size_t
+    {
+        std::size_t written = 0;
+        while (written < data.size())
+        {
+            const auto space = prepareWrite();
+            if (space.empty())
+            {
+                break;
+            }
+            const auto chunk = std::min(space.size(), data.size() - written);
+            std::copy_n(data.begin() + static_cast<std::ptrdiff_t>(written), chunk, space.begin());
+            commitWrite(chunk);
+            written += chunk;
+        }
+        return written;
+    }
+
+    // Consumer: contiguous readable region, ending at the ring boundary at the latest.
+    [[nodiscard]] auto prepareRead() noexcept -> std::span<const std::byte>
+    {
+        const auto read_pos = read_pos_.load(std::memory_order_relaxed);
+        if (cached_write_pos_ == read_pos)
+        {
+            cached_write_pos_ = write_pos_.load(std::memory_order_acquire);
+        }
+        const auto offset = read_pos & kMask;
+        const auto available = cached_write_pos_ - read_pos;
+        return std::span<const std::byte>(storage_).subspan(offset, std::min(available, Capacity - offset));
+    }
+
+    // Consumer: release @p count bytes of the last prepareRead() region back to the producer.
+    auto commitRead(std::size_t count) noexcept -> void
+    {
+        read_pos_.store(read_pos_.load(std::memory_order_relaxed) + count, std::memory_order_release);
+    }
+
+    // Consumer: copy up to out.size() bytes, wrapping around the ring end. Returns bytes read.
+    auto read(std::span<std::byte> out) noexcept -> std::size_t
+    {
+        std::size_t done = 0;
+        while (done < out.size())
+        {
+            const auto data = prepareRead();
+            if (data.empty())
+            {
+                break;
+            }
+            const auto chunk = std::min(data.size(), out.size() - done);
+            std::copy_n(data.begin(), chunk, out.begin() + static_cast<std::ptrdiff_t>(done));
+            commitRead(chunk);
+            done += chunk;
+        }
+        return done;
+    }
+
+    // Consumer: drop everything published so far (serialClearBufferIn() semantics).
+    auto clear() noexcept -> void
+    {
+        cached_write_pos_ = write_pos_.load(std::memory_order_acquire);
+        read_pos_.store(cached_write_pos_, std::memory_order_release);
+    }
+
+  private:
+    static constexpr std::size_t kMask = Capacity - 1;
+
+    // Producer-owned line.
+    alignas(kCacheLineSize) std::atomic<std::size_t> write_pos_{0};
+    std::size_t cached_read_pos_{0};
+
+    // Consumer-owned line.
+    alignas(kCacheLineSize) std::atomic<std::size_t> read_pos_{0};
+    std::size_t cached_write_pos_{0};
+
+    alignas(kCacheLineSize) std::array<std::byte, Capacity> storage_{};
+};
+
+} // namespace cpp_core
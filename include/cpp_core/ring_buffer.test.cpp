@@ -0,0 +1,22 @@
+#include "cpp_core/ring_buffer.hpp"
+#include "cpp_core/serial_config.hpp"
+
+#include <cstddef>
+#include <span>
+#include <utility>
+
+namespace cpp_core::tests::ring_buffer
+{
+
+using Ring = RingBuffer<4096>;
+
+static_assert(Ring::capacity() == 4096);
+static_assert(alignof(Ring) == kCacheLineSize);
+static_assert(sizeof(Ring) == (2 * kCacheLineSize) + 4096);
+
+// Reservations plug straight into the buffer concepts used by the read/write helpers.
+static_assert(ByteBuffer<decltype(std::declval<Ring &>().prepareWrite())>);
+static_assert(ConstByteBuffer<decltype(std::declval<Ring &>().prepareRead())>);
+static_assert(!ByteBuffer<decltype(std::declval<Ring &>().prepareRead())>);
+
+} // namespace cpp_core::tests::ring_buffer
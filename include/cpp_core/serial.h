@@ -4,10 +4,18 @@
 #include "interface/get_version.h"
 #include "interface/serial_abort_read.h"
 #include "interface/serial_abort_write.h"
+#include "interface/serial_capture_start.h"
+#include "interface/serial_capture_stop.h"
 #include "interface/serial_clear_buffer_in.h"
 #include "interface/serial_clear_buffer_out.h"
+#include "interface/serial_clear_pool.h"
 #include "interface/serial_close.h"
+#include "interface/serial_dispatch_events.h"
 #include "interface/serial_drain.h"
+#include "interface/serial_get_event_handle.h"
+#include "interface/serial_get_latency_histogram.h"
+#include "interface/serial_get_stats.h"
+#include "interface/serial_get_wait_handle.h"
 #include "interface/serial_in_bytes_total.h"
 #include "interface/serial_in_bytes_waiting.h"
 #include "interface/serial_list_ports.h"
@@ -15,14 +23,36 @@
 #include "interface/serial_open.h"
 #include "interface/serial_out_bytes_total.h"
 #include "interface/serial_out_bytes_waiting.h"
+#include "interface/serial_peek.h"
+#include "interface/serial_poll.h"
 #include "interface/serial_read.h"
+#include "interface/serial_read_for.h"
 #include "interface/serial_read_line.h"
+#include "interface/serial_read_line_for.h"
+#include "interface/serial_read_many.h"
 #include "interface/serial_read_until.h"
+#include "interface/serial_read_until_for.h"
 #include "interface/serial_read_until_sequence.h"
+#include "interface/serial_read_until_sequence_for.h"
+#include "interface/serial_read_v.h"
+#include "interface/serial_reap.h"
+#include "interface/serial_rx_acquire.h"
+#include "interface/serial_rx_release.h"
 #include "interface/serial_set_error_callback.h"
+#include "interface/serial_set_handle_read_callback.h"
+#include "interface/serial_set_handle_write_callback.h"
+#include "interface/serial_set_latency_histograms.h"
+#include "interface/serial_set_pool_options.h"
 #include "interface/serial_set_read_callback.h"
+#include "interface/serial_set_tracing.h"
 #include "interface/serial_set_write_callback.h"
+#include "interface/serial_status_name.h"
+#include "interface/serial_status_table.h"
+#include "interface/serial_submit.h"
+#include "interface/serial_trace_dump.h"
 #include "interface/serial_write.h"
+#include "interface/serial_write_for.h"
+#include "interface/serial_write_v.h"
 
 // Modem line control
 #include "interface/serial_set_dtr.h"
@@ -40,6 +70,7 @@
 #include "interface/serial_get_flow_control.h"
 
 // Line-setting setters
+#include "interface/serial_configure.h"
 #include "interface/serial_set_baudrate.h"
 #include "interface/serial_set_data_bits.h"
 #include "interface/serial_set_parity.h"
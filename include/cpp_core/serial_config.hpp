@@ -1,10 +1,13 @@
 #pragma once
 
 #include "result.hpp"
+#include "serial_line_config.h"
 #include "strong_types.hpp"
 
+#include <bit>
 #include <cstddef>
 #include <concepts>
+#include <functional>
 #include <utility>
 #include <type_traits>
 
@@ -36,12 +39,39 @@ constexpr auto validateStopBits(StopBits stop_bits) -> bool
     return stop_bits == StopBits::kOne || stop_bits == StopBits::kTwo;
 }
 
+constexpr auto validateFlowControl(FlowControl flow_control) -> bool
+{
+    return flow_control == FlowControl::kNone || flow_control == FlowControl::kRtsCts
+        || flow_control == FlowControl::kXonXoff;
+}
+
+constexpr auto validateTimeouts(int timeout_ms, int multiplier) -> bool
+{
+    return timeout_ms >= 0 && multiplier >= 0;
+}
+
 } // namespace detail
 
+// Bits returned by SerialConfig::changedFields().
+enum class ConfigField : int
+{
+    kNone = 0,
+    kBaudrate = 1,
+    kDataBits = 2,
+    kParity = 4,
+    kStopBits = 8,
+    kFlowControl = 16,
+    kTimeouts = 32,
+};
+
 /**
  * Compile-time validated serial configuration.
  * Invalid configs are rejected at compile time - no runtime overhead.
  *   constexpr auto kCfg = SerialConfig::make<9600, 8, Parity::kNone, StopBits::kOne>();
+ *
+ * Shares its layout with SerialLineConfig, the serialConfigure() payload; see toLineConfig().
+ * `timeout_ms` / `multiplier` are the driver-level read timeouts (VTIME / COMMTIMEOUTS) a binding
+ * applies when a call does not pass its own.
  */
 struct SerialConfig
 {
@@ -49,8 +79,12 @@ struct SerialConfig
     int data_bits;
     Parity parity;
     StopBits stop_bits;
+    FlowControl flow_control;
+    int timeout_ms;
+    int multiplier;
 
-    template <int Baud, int DataBitsVal, Parity P = Parity::kNone, StopBits S = StopBits::kOne>
+    template <int Baud, int DataBitsVal, Parity P = Parity::kNone, StopBits S = StopBits::kOne,
+              FlowControl F = FlowControl::kNone>
     static consteval auto make() -> SerialConfig
     {
         static_assert(detail::validateBaudrate(Baud), "Baudrate must be >= 300");
@@ -61,23 +95,43 @@ struct SerialConfig
             .data_bits = DataBitsVal,
             .parity = P,
             .stop_bits = S,
+            .flow_control = F,
+            .timeout_ms = 0,
+            .multiplier = 0,
         };
     }
 
     [[nodiscard]] static constexpr auto tryMake(Baudrate baud, DataBits data_bits, Parity parity = Parity::kNone,
-                                                StopBits stop_bits = StopBits::kOne) -> Result<SerialConfig>
+                                                StopBits stop_bits = StopBits::kOne,
+                                                FlowControl flow_control = FlowControl::kNone) -> Result<SerialConfig>
     {
-        return tryMake(baud.get(), data_bits.get(), parity, stop_bits);
+        return tryMake(baud.get(), data_bits.get(), parity, stop_bits, flow_control);
     }
 
     [[nodiscard]] static constexpr auto tryMake(int baud, int data_bits_val, Parity parity = Parity::kNone,
-                                                StopBits stop_bits = StopBits::kOne) -> Result<SerialConfig>
+                                                StopBits stop_bits = StopBits::kOne,
+                                                FlowControl flow_control = FlowControl::kNone) -> Result<SerialConfig>
+    {
+        return SerialConfig{
+            .baudrate = baud,
+            .data_bits = data_bits_val,
+            .parity = parity,
+            .stop_bits = stop_bits,
+            .flow_control = flow_control,
+            .timeout_ms = 0,
+            .multiplier = 0,
+        }
+            .validated();
+    }
+
+    // Returns *this if every field is valid, otherwise the error of the first invalid field.
+    [[nodiscard]] constexpr auto validated() const -> Result<SerialConfig>
     {
-        if (!detail::validateBaudrate(baud))
+        if (!detail::validateBaudrate(baudrate))
         {
             return fail<SerialConfig>(StatusCode::Configuration::kSetBaudrateError);
         }
-        if (!detail::validateDataBits(data_bits_val))
+        if (!detail::validateDataBits(data_bits))
         {
             return fail<SerialConfig>(StatusCode::Configuration::kSetDataBitsError);
         }
@@ -89,18 +143,22 @@ struct SerialConfig
         {
             return fail<SerialConfig>(StatusCode::Configuration::kSetStopBitsError);
         }
-        return ok(SerialConfig{
-            .baudrate = baud,
-            .data_bits = data_bits_val,
-            .parity = parity,
-            .stop_bits = stop_bits,
-        });
+        if (!detail::validateFlowControl(flow_control))
+        {
+            return fail<SerialConfig>(StatusCode::Configuration::kSetFlowControlError);
+        }
+        if (!detail::validateTimeouts(timeout_ms, multiplier))
+        {
+            return fail<SerialConfig>(StatusCode::Configuration::kSetTimeoutError);
+        }
+        return ok(*this);
     }
 
     [[nodiscard]] constexpr auto isValid() const noexcept -> bool
     {
         return detail::validateBaudrate(baudrate) && detail::validateDataBits(data_bits)
-            && detail::validateParity(parity) && detail::validateStopBits(stop_bits);
+            && detail::validateParity(parity) && detail::validateStopBits(stop_bits)
+            && detail::validateFlowControl(flow_control) && detail::validateTimeouts(timeout_ms, multiplier);
     }
 
     [[nodiscard]] constexpr auto baudrateValue() const noexcept -> Baudrate
@@ -123,19 +181,107 @@ struct SerialConfig
         return toInt(stop_bits);
     }
 
+    [[nodiscard]] constexpr auto flowControlInt() const noexcept -> int
+    {
+        return toInt(flow_control);
+    }
+
     [[nodiscard]] constexpr auto withBaudrate(Baudrate baud) const -> Result<SerialConfig>
     {
-        return tryMake(baud, dataBitsValue(), parity, stop_bits);
+        auto next = *this;
+        next.baudrate = baud.get();
+        return next.validated();
     }
 
     [[nodiscard]] constexpr auto withDataBits(DataBits bits) const -> Result<SerialConfig>
     {
-        return tryMake(baudrateValue(), bits, parity, stop_bits);
+        auto next = *this;
+        next.data_bits = bits.get();
+        return next.validated();
+    }
+
+    [[nodiscard]] constexpr auto withFlowControl(FlowControl mode) const -> Result<SerialConfig>
+    {
+        auto next = *this;
+        next.flow_control = mode;
+        return next.validated();
+    }
+
+    [[nodiscard]] constexpr auto withTimeouts(TimeoutMs timeout, Multiplier factor) const -> Result<SerialConfig>
+    {
+        auto next = *this;
+        next.timeout_ms = timeout.get();
+        next.multiplier = factor.get();
+        return next.validated();
+    }
+
+    // Bitmask of ConfigField values that differ between *this and @p other (0 if equal).
+    [[nodiscard]] constexpr auto changedFields(const SerialConfig &other) const noexcept -> int
+    {
+        int mask = toInt(ConfigField::kNone);
+        mask |= baudrate != other.baudrate ? toInt(ConfigField::kBaudrate) : 0;
+        mask |= data_bits != other.data_bits ? toInt(ConfigField::kDataBits) : 0;
+        mask |= parity != other.parity ? toInt(ConfigField::kParity) : 0;
+        mask |= stop_bits != other.stop_bits ? toInt(ConfigField::kStopBits) : 0;
+        mask |= flow_control != other.flow_control ? toInt(ConfigField::kFlowControl) : 0;
+        mask |= timeout_ms != other.timeout_ms || multiplier != other.multiplier ? toInt(ConfigField::kTimeouts) : 0;
+        return mask;
     }
 
     [[nodiscard]] constexpr auto operator<=>(const SerialConfig &) const noexcept = default;
 };
 
+// SerialConfig and the C ABI's SerialLineConfig must stay interchangeable field for field.
+static_assert(std::is_standard_layout_v<SerialConfig> && std::is_trivially_copyable_v<SerialConfig>);
+static_assert(sizeof(SerialConfig) == sizeof(SerialLineConfig));
+static_assert(offsetof(SerialConfig, baudrate) == offsetof(SerialLineConfig, baudrate)
+              && offsetof(SerialConfig, data_bits) == offsetof(SerialLineConfig, data_bits)
+              && offsetof(SerialConfig, parity) == offsetof(SerialLineConfig, parity)
+              && offsetof(SerialConfig, stop_bits) == offsetof(SerialLineConfig, stop_bits)
+              && offsetof(SerialConfig, flow_control) == offsetof(SerialLineConfig, flow_control)
+              && offsetof(SerialConfig, timeout_ms) == offsetof(SerialLineConfig, timeout_ms)
+              && offsetof(SerialConfig, multiplier) == offsetof(SerialLineConfig, multiplier));
+
+// serialConfigure() payload for @p config; bindings convert back with fromLineConfig() and validate.
+[[nodiscard]] constexpr auto toLineConfig(const SerialConfig &config) noexcept -> SerialLineConfig
+{
+    return std::bit_cast<SerialLineConfig>(config);
+}
+
+[[nodiscard]] constexpr auto fromLineConfig(const SerialLineConfig &config) noexcept -> SerialConfig
+{
+    return std::bit_cast<SerialConfig>(config);
+}
+
+/**
+ * Shared serialConfigure() flow for both platforms.
+ * Validates @p wanted, skips the OS entirely when it equals the cached @p current config, otherwise
+ * calls @p apply once with the new config and the changed-field mask and updates the cache on success.
+ *   return toCStatus(applyConfig(port.config, *config, [&](const SerialConfig &cfg, int changed) {
+ *       return writeTermios(port.fd, cfg, changed);
+ *   }), error_callback);
+ */
+template <typename Apply>
+requires std::is_invocable_r_v<Status, Apply, const SerialConfig &, int>
+constexpr auto applyConfig(SerialConfig &current, const SerialConfig &wanted, Apply &&apply) -> Status
+{
+    auto checked = wanted.validated();
+    if (!checked)
+    {
+        return forwardUnexpected(std::move(checked));
+    }
+    if (current == wanted)
+    {
+        return ok();
+    }
+    auto applied = std::invoke(std::forward<Apply>(apply), wanted, current.changedFields(wanted));
+    if (applied)
+    {
+        current = wanted;
+    }
+    return applied;
+}
+
 // Concepts for serial port operations
 
 // clang-format off
@@ -1,6 +1,9 @@
 #include "cpp_core/reflection.hpp"
 #include "cpp_core/serial_config.hpp"
 
+#include <cstdint>
+#include <type_traits>
+
 namespace cpp_core::tests::serial_config
 {
 
@@ -41,5 +44,53 @@ static_assert(kRetunedConfig->baudrateValue() == Baudrate{230'400});
 
 static_assert(cpp_core::reflection::publicFieldName<SerialConfig, 0>() == "baudrate");
 static_assert(cpp_core::reflection::publicFieldName<SerialConfig, 1>() == "data_bits");
+static_assert(cpp_core::reflection::publicFieldName<SerialConfig, 4>() == "flow_control");
+static_assert(cpp_core::reflection::publicFieldName<SerialConfig, 6>() == "multiplier");
+
+// serialConfigure() hands the struct across the C ABI as seven int32 values.
+static_assert(sizeof(SerialLineConfig) == 7 * sizeof(std::int32_t));
+static_assert(toLineConfig(*kRetunedConfig).baudrate == 230'400 && toLineConfig(*kRetunedConfig).stop_bits == 2);
+static_assert(fromLineConfig(toLineConfig(*kRetunedConfig)) == *kRetunedConfig);
+static_assert(fromLineConfig(SerialLineConfig{9600, 8, 1, 0, 1, 0, 0}).parity == Parity::kEven);
+
+static_assert(kCompileTimeConfig.flow_control == FlowControl::kNone);
+static_assert(kCompileTimeConfig.withFlowControl(FlowControl::kRtsCts)->flowControlInt() == 1);
+static_assert(kRetunedConfig->stop_bits == StopBits::kTwo);
+
+consteval auto rejectsBadTimeouts() -> bool
+{
+    const auto bad = kCompileTimeConfig.withTimeouts(TimeoutMs{-1}, Multiplier{0});
+    return !bad.has_value() && bad.error() == StatusCode::Configuration::kSetTimeoutError;
+}
+
+static_assert(rejectsBadTimeouts());
+static_assert(kCompileTimeConfig.changedFields(kCompileTimeConfig) == 0);
+static_assert(kCompileTimeConfig.changedFields(*kRetunedConfig) == toInt(ConfigField::kBaudrate));
+static_assert(kCompileTimeConfig.changedFields(*kCompileTimeConfig.withTimeouts(TimeoutMs{10}, Multiplier{1}))
+              == toInt(ConfigField::kTimeouts));
+
+consteval auto applyConfigSkipsUnchanged() -> bool
+{
+    auto current = kCompileTimeConfig;
+    int calls = 0;
+    const auto apply = [&calls](const SerialConfig &, int) -> Status {
+        ++calls;
+        return ok();
+    };
+    const auto same = applyConfig(current, kCompileTimeConfig, apply);
+    const auto changed = applyConfig(current, *kRetunedConfig, apply);
+    return same.has_value() && changed.has_value() && calls == 1 && current == *kRetunedConfig;
+}
+
+consteval auto applyConfigKeepsCacheOnFailure() -> bool
+{
+    auto current = kCompileTimeConfig;
+    const auto reject = [](const SerialConfig &, int) -> Status { return fail(StatusCode::Control::kSetStateError); };
+    const auto result = applyConfig(current, *kRetunedConfig, reject);
+    return !result.has_value() && current == kCompileTimeConfig;
+}
+
+static_assert(applyConfigSkipsUnchanged());
+static_assert(applyConfigKeepsCacheOnFailure());
 
 } // namespace cpp_core::tests::serial_config
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    namespace cpp_core
+    {
+    /**
+     * @brief Plain-C line configuration passed to serialConfigure().
+     *
+     * Seven consecutive 32-bit ints, so FFI hosts can mirror it as a plain int32 array.
+     * Enumerated fields use the values of the matching serialSet*() calls: parity 0 = none,
+     * 1 = even, 2 = odd; stop_bits 0 = 1, 2 = 2; flow_control 0 = none, 1 = RTS/CTS, 2 = XON/XOFF.
+     * C++ code builds it from ::cpp_core::SerialConfig, which has the same layout.
+     */
+    struct SerialLineConfig
+    {
+        int32_t baudrate;
+        int32_t data_bits;
+        int32_t parity;
+        int32_t stop_bits;
+        int32_t flow_control;
+        int32_t timeout_ms;
+        int32_t multiplier;
+    };
+    } // namespace cpp_core
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
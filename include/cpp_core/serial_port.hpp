@@ -0,0 +1,386 @@
+#pragma once
+
+#include "error_handling.hpp"
+#include "result.hpp"
+#include "serial.h"
+#include "serial_config.hpp"
+#include "status_code.h"
+#include "strong_types.hpp"
+#include "unique_resource.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+namespace cpp_core
+{
+
+namespace detail::serial_port
+{
+
+// The full text stays here, once per thread; the Error handed out carries ErrorMessage's short copy.
+struct LastError
+{
+    StatusCodeValue code = StatusCode::kSuccess;
+    std::array<char, kErrorMessageBufferSize> text{};
+    std::size_t size = 0;
+
+    [[nodiscard]] auto view() const noexcept -> std::string_view
+    {
+        return {text.data(), size};
+    }
+};
+
+// Filled by errorTrampoline() on the calling thread and consumed by the wrapper call that passed it.
+inline thread_local LastError last_error{};
+
+// Binding messages are capped at kErrorMessageBufferSize by invokeError(), so the text is kept whole.
+inline auto errorTrampoline(int error_code, const char *message) -> void
+{
+    last_error.code = error_code;
+    last_error.size = 0;
+    cpp_core::detail::appendMessage(last_error.text, last_error.size,
+                                    message != nullptr ? std::string_view{message} : std::string_view{});
+}
+
+[[nodiscard]] constexpr auto clampSize(std::size_t size) noexcept -> int
+{
+    return static_cast<int>(std::min<std::size_t>(size, INT_MAX));
+}
+
+// Negative C return value -> Error, carrying the text the binding reported for it, if any.
+[[nodiscard]] inline auto takeError(std::int64_t code) -> Error
+{
+    if (last_error.code != code)
+    {
+        return Error{code};
+    }
+    last_error.code = StatusCode::kSuccess;
+    return Error{code, ErrorMessage{last_error.view()}};
+}
+
+template <typename T> [[nodiscard]] inline auto toResult(std::int64_t value) -> Result<T>
+{
+    if (value >= 0) [[likely]]
+    {
+        return static_cast<T>(value);
+    }
+    return std::unexpected(takeError(value));
+}
+
+[[nodiscard]] inline auto toStatus(std::int64_t value) -> Status
+{
+    if (value >= 0) [[likely]]
+    {
+        return {};
+    }
+    return std::unexpected(takeError(value));
+}
+
+} // namespace detail::serial_port
+
+// Owns a serialOpen() handle; closing goes through serialClose() (and thus the warm-reopen pool).
+struct SerialPortTraits
+{
+    using handle_type = std::int64_t;
+
+    static constexpr auto invalid() noexcept -> handle_type
+    {
+        return 0;
+    }
+
+    static auto close(handle_type handle) noexcept -> void
+    {
+        static_cast<void>(serialClose(handle));
+    }
+};
+
+/**
+ * Move-only C++ view of the serial.h ABI. Every member is a single inline call into the binding with
+ * the error callback pointed at a thread-local trampoline, so the success path is the raw call plus a
+ * sign check; failures come back as Result with the binding's message attached.
+ *   auto port = SerialPort::open("/dev/ttyUSB0", SerialConfig::make<115200, 8>());
+ *   std::array<std::byte, 256> line{};
+ *   auto got = port->readLine(line, TimeoutMs{500}, Multiplier{1});
+ */
+class SerialPort
+{
+  public:
+    using Handle = UniqueResource<SerialPortTraits>;
+
+    SerialPort() noexcept = default;
+
+    explicit SerialPort(Handle handle) noexcept : handle_(std::move(handle))
+    {
+    }
+
+    // @p path is a NUL-terminated device name. Flow control and driver timeouts are applied through
+    // serialConfigure() only when @p config sets them.
+    [[nodiscard]] static auto open(const char *path, const SerialConfig &config) -> Result<SerialPort>
+    {
+        auto opened = detail::serial_port::toResult<std::int64_t>(
+            serialOpen(const_cast<char *>(path), config.baudrate, config.data_bits, config.parityInt(),
+                       config.stopBitsInt(), &detail::serial_port::errorTrampoline));
+        if (!opened)
+        {
+            return forwardUnexpected(std::move(opened));
+        }
+        SerialPort port{Handle{*opened}};
+        if (config.flow_control != FlowControl::kNone || config.timeout_ms != 0 || config.multiplier != 0)
+        {
+            if (auto configured = port.configure(config); !configured)
+            {
+                return forwardUnexpected(std::move(configured));
+            }
+        }
+        return port;
+    }
+
+    // Full binding text of the last failed call on this thread, valid until the next one fails; the
+    // message in the returned Error may be a truncated copy of it.
+    [[nodiscard]] static auto lastErrorText() noexcept -> std::string_view
+    {
+        return detail::serial_port::last_error.view();
+    }
+
+    [[nodiscard]] auto handle() const noexcept -> std::int64_t
+    {
+        return handle_.get();
+    }
+
+    [[nodiscard]] auto valid() const noexcept -> bool
+    {
+        return handle_.valid();
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept
+    {
+        return valid();
+    }
+
+    // Give up ownership without closing, e.g. to hand the handle to code speaking the C ABI.
+    [[nodiscard]] auto release() noexcept -> std::int64_t
+    {
+        return handle_.release();
+    }
+
+    // Close now and report the serialClose() result; the destructor closes silently.
+    auto close() -> Status
+    {
+        return detail::serial_port::toStatus(serialClose(handle_.release(), &detail::serial_port::errorTrampoline));
+    }
+
+    // Reads
+
+    template <ByteBuffer Buffer>
+    [[nodiscard]] auto read(Buffer &&buffer, TimeoutMs timeout, Multiplier multiplier) -> Result<std::size_t>
+    {
+        return detail::serial_port::toResult<std::size_t>(
+            serialRead(handle(), buffer.data(), detail::serial_port::clampSize(buffer.size()), timeout.get(),
+                       multiplier.get(), &detail::serial_port::errorTrampoline));
+    }
+
+    template <ByteBuffer Buffer>
+    [[nodiscard]] auto readFor(Buffer &&buffer, TotalTimeoutMs total_timeout) -> Result<std::size_t>
+    {
+        return detail::serial_port::toResult<std::size_t>(
+            serialReadFor(handle(), buffer.data(), detail::serial_port::clampSize(buffer.size()), total_timeout.get(),
+                          &detail::serial_port::errorTrampoline));
+    }
+
+    template <ByteBuffer Buffer>
+    [[nodiscard]] auto readLine(Buffer &&buffer, TimeoutMs timeout, Multiplier multiplier) -> Result<std::size_t>
+    {
+        return detail::serial_port::toResult<std::size_t>(
+            serialReadLine(handle(), buffer.data(), detail::serial_port::clampSize(buffer.size()), timeout.get(),
+                           multiplier.get(), &detail::serial_port::errorTrampoline));
+    }
+
+    template <ByteBuffer Buffer>
+    [[nodiscard]] auto readLineFor(Buffer &&buffer, TotalTimeoutMs total_timeout) -> Result<std::size_t>
+    {
+        return detail::serial_port::toResult<std::size_t>(
+            serialReadLineFor(handle(), buffer.data(), detail::serial_port::clampSize(buffer.size()),
+                              total_timeout.get(), &detail::serial_port::errorTrampoline));
+    }
+
+    template <ByteBuffer Buffer>
+    [[nodiscard]] auto readUntil(Buffer &&buffer, std::byte terminator, TimeoutMs timeout, Multiplier multiplier)
+        -> Result<std::size_t>
+    {
+        return detail::serial_port::toResult<std::size_t>(serialReadUntil(
+            handle(), buffer.data(), detail::serial_port::clampSize(buffer.size()), timeout.get(), multiplier.get(),
+            &terminator, &detail::serial_port::errorTrampoline));
+    }
+
+    template <ByteBuffer Buffer>
+    [[nodiscard]] auto readUntilFor(Buffer &&buffer, std::byte terminator, TotalTimeoutMs total_timeout)
+        -> Result<std::size_t>
+    {
+        return detail::serial_port::toResult<std::size_t>(
+            serialReadUntilFor(handle(), buffer.data(), detail::serial_port::clampSize(buffer.size()),
+                               total_timeout.get(), &terminator, &detail::serial_port::errorTrampoline));
+    }
+
+    // @p sequence is NUL-terminated, as the ABI expects.
+    template <ByteBuffer Buffer>
+    [[nodiscard]] auto readUntilSequence(Buffer &&buffer, const char *sequence, TimeoutMs timeout,
+                                         Multiplier multiplier) -> Result<std::size_t>
+    {
+        return detail::serial_port::toResult<std::size_t>(serialReadUntilSequence(
+            handle(), buffer.data(), detail::serial_port::clampSize(buffer.size()), timeout.get(), multiplier.get(),
+            const_cast<char *>(sequence), &detail::serial_port::errorTrampoline));
+    }
+
+    template <ByteBuffer Buffer>
+    [[nodiscard]] auto readUntilSequenceFor(Buffer &&buffer, const char *sequence, TotalTimeoutMs total_timeout)
+        -> Result<std::size_t>
+    {
+        return detail::serial_port::toResult<std::size_t>(serialReadUntilSequenceFor(
+            handle(), buffer.data(), detail::serial_port::clampSize(buffer.size()), total_timeout.get(),
+            const_cast<char *>(sequence), &detail::serial_port::errorTrampoline));
+    }
+
+    template <ByteBuffer Buffer>
+    [[nodiscard]] auto peek(Buffer &&buffer, TimeoutMs timeout) -> Result<std::size_t>
+    {
+        return detail::serial_port::toResult<std::size_t>(serialPeek(handle(), buffer.data(),
+                                                                     detail::serial_port::clampSize(buffer.size()),
+                                                                     timeout.get(),
+                                                                     &detail::serial_port::errorTrampoline));
+    }
+
+    // Writes
+
+    template <ConstByteBuffer Buffer>
+    [[nodiscard]] auto write(const Buffer &buffer, TimeoutMs timeout, Multiplier multiplier) -> Result<std::size_t>
+    {
+        return detail::serial_port::toResult<std::size_t>(
+            serialWrite(handle(), buffer.data(), detail::serial_port::clampSize(buffer.size()), timeout.get(),
+                        multiplier.get(), &detail::serial_port::errorTrampoline));
+    }
+
+    template <ConstByteBuffer Buffer>
+    [[nodiscard]] auto writeFor(const Buffer &buffer, TotalTimeoutMs total_timeout) -> Result<std::size_t>
+    {
+        return detail::serial_port::toResult<std::size_t>(
+            serialWriteFor(handle(), buffer.data(), detail::serial_port::clampSize(buffer.size()), total_timeout.get(),
+                           &detail::serial_port::errorTrampoline));
+    }
+
+    // Buffers and cancellation
+
+    [[nodiscard]] auto inBytesWaiting() const -> Result<std::size_t>
+    {
+        return detail::serial_port::toResult<std::size_t>(
+            serialInBytesWaiting(handle(), &detail::serial_port::errorTrampoline));
+    }
+
+    [[nodiscard]] auto outBytesWaiting() const -> Result<std::size_t>
+    {
+        return detail::serial_port::toResult<std::size_t>(
+            serialOutBytesWaiting(handle(), &detail::serial_port::errorTrampoline));
+    }
+
+    auto drain() -> Status
+    {
+        return detail::serial_port::toStatus(serialDrain(handle(), &detail::serial_port::errorTrampoline));
+    }
+
+    auto clearBufferIn() -> Status
+    {
+        return detail::serial_port::toStatus(serialClearBufferIn(handle(), &detail::serial_port::errorTrampoline));
+    }
+
+    auto clearBufferOut() -> Status
+    {
+        return detail::serial_port::toStatus(serialClearBufferOut(handle(), &detail::serial_port::errorTrampoline));
+    }
+
+    // Safe to call from another thread while a read/write on this port is blocked.
+    auto abortRead() const -> Status
+    {
+        return detail::serial_port::toStatus(serialAbortRead(handle(), &detail::serial_port::errorTrampoline));
+    }
+
+    auto abortWrite() const -> Status
+    {
+        return detail::serial_port::toStatus(serialAbortWrite(handle(), &detail::serial_port::errorTrampoline));
+    }
+
+    [[nodiscard]] auto waitHandle() const -> Result<std::int64_t>
+    {
+        return detail::serial_port::toResult<std::int64_t>(
+            serialGetWaitHandle(handle(), &detail::serial_port::errorTrampoline));
+    }
+
+    // Line settings and statistics
+
+    auto configure(const SerialConfig &config) -> Status
+    {
+        const auto line = toLineConfig(config);
+        return detail::serial_port::toStatus(serialConfigure(handle(), &line, &detail::serial_port::errorTrampoline));
+    }
+
+    [[nodiscard]] auto stats() const -> Result<SerialStats>
+    {
+        SerialStats out{};
+        if (auto status = detail::serial_port::toStatus(
+                serialGetStats(handle(), &out, &detail::serial_port::errorTrampoline));
+            !status)
+        {
+            return forwardUnexpected(std::move(status));
+        }
+        return out;
+    }
+
+    // Modem lines
+
+    auto setDtr(bool asserted) -> Status
+    {
+        return detail::serial_port::toStatus(
+            serialSetDtr(handle(), asserted ? 1 : 0, &detail::serial_port::errorTrampoline));
+    }
+
+    auto setRts(bool asserted) -> Status
+    {
+        return detail::serial_port::toStatus(
+            serialSetRts(handle(), asserted ? 1 : 0, &detail::serial_port::errorTrampoline));
+    }
+
+    [[nodiscard]] auto cts() const -> Result<bool>
+    {
+        return detail::serial_port::toResult<bool>(serialGetCts(handle(), &detail::serial_port::errorTrampoline));
+    }
+
+    [[nodiscard]] auto dsr() const -> Result<bool>
+    {
+        return detail::serial_port::toResult<bool>(serialGetDsr(handle(), &detail::serial_port::errorTrampoline));
+    }
+
+    [[nodiscard]] auto dcd() const -> Result<bool>
+    {
+        return detail::serial_port::toResult<bool>(serialGetDcd(handle(), &detail::serial_port::errorTrampoline));
+    }
+
+    [[nodiscard]] auto ri() const -> Result<bool>
+    {
+        return detail::serial_port::toResult<bool>(serialGetRi(handle(), &detail::serial_port::errorTrampoline));
+    }
+
+    auto sendBreak(std::chrono::milliseconds duration) -> Status
+    {
+        return detail::serial_port::toStatus(serialSendBreak(
+            handle(), static_cast<int>(duration.count()), &detail::serial_port::errorTrampoline));
+    }
+
+  private:
+    Handle handle_;
+};
+
+} // namespace cpp_core
@@ -0,0 +1,100 @@
+#include "cpp_core/serial_port.hpp"
+
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace cpp_core::tests::serial_port
+{
+
+// The wrapper forwards to these exact ABI shapes; any drift in serial.h breaks the build here instead of
+// silently converting arguments.
+using ReadFn = int(std::int64_t, void *, int, int, int, ErrorCallbackT);
+using ReadForFn = int(std::int64_t, void *, int, int, ErrorCallbackT);
+using ReadUntilFn = int(std::int64_t, void *, int, int, int, void *, ErrorCallbackT);
+using ReadUntilForFn = int(std::int64_t, void *, int, int, void *, ErrorCallbackT);
+using PeekFn = int(std::int64_t, void *, int, int, ErrorCallbackT);
+using WriteFn = int(std::int64_t, const void *, int, int, int, ErrorCallbackT);
+using WriteForFn = int(std::int64_t, const void *, int, int, ErrorCallbackT);
+using HandleFn = int(std::int64_t, ErrorCallbackT);
+using LineStateFn = int(std::int64_t, int, ErrorCallbackT);
+
+static_assert(std::is_same_v<decltype(serialOpen), std::intptr_t(void *, int, int, int, int, ErrorCallbackT)>);
+static_assert(std::is_same_v<decltype(serialClose), HandleFn>);
+static_assert(std::is_same_v<decltype(serialRead), ReadFn>);
+static_assert(std::is_same_v<decltype(serialReadLine), ReadFn>);
+static_assert(std::is_same_v<decltype(serialReadFor), ReadForFn>);
+static_assert(std::is_same_v<decltype(serialReadLineFor), ReadForFn>);
+static_assert(std::is_same_v<decltype(serialReadUntil), ReadUntilFn>);
+static_assert(std::is_same_v<decltype(serialReadUntilSequence), ReadUntilFn>);
+static_assert(std::is_same_v<decltype(serialReadUntilFor), ReadUntilForFn>);
+static_assert(std::is_same_v<decltype(serialReadUntilSequenceFor), ReadUntilForFn>);
+static_assert(std::is_same_v<decltype(serialPeek), PeekFn>);
+static_assert(std::is_same_v<decltype(serialWrite), WriteFn>);
+static_assert(std::is_same_v<decltype(serialWriteFor), WriteForFn>);
+static_assert(std::is_same_v<decltype(serialInBytesWaiting), HandleFn>);
+static_assert(std::is_same_v<decltype(serialOutBytesWaiting), HandleFn>);
+static_assert(std::is_same_v<decltype(serialDrain), HandleFn>);
+static_assert(std::is_same_v<decltype(serialClearBufferIn), HandleFn>);
+static_assert(std::is_same_v<decltype(serialClearBufferOut), HandleFn>);
+static_assert(std::is_same_v<decltype(serialAbortRead), HandleFn>);
+static_assert(std::is_same_v<decltype(serialAbortWrite), HandleFn>);
+static_assert(std::is_same_v<decltype(serialGetWaitHandle), std::int64_t(std::int64_t, ErrorCallbackT)>);
+static_assert(std::is_same_v<decltype(serialConfigure), int(std::int64_t, const SerialLineConfig *, ErrorCallbackT)>);
+static_assert(std::is_same_v<decltype(serialGetStats), int(std::int64_t, SerialStats *, ErrorCallbackT)>);
+static_assert(std::is_same_v<decltype(serialSetDtr), LineStateFn>);
+static_assert(std::is_same_v<decltype(serialSetRts), LineStateFn>);
+static_assert(std::is_same_v<decltype(serialGetCts), HandleFn>);
+static_assert(std::is_same_v<decltype(serialGetDsr), HandleFn>);
+static_assert(std::is_same_v<decltype(serialGetDcd), HandleFn>);
+static_assert(std::is_same_v<decltype(serialGetRi), HandleFn>);
+static_assert(std::is_same_v<decltype(serialSendBreak), LineStateFn>);
+static_assert(std::is_convertible_v<decltype(&detail::serial_port::errorTrampoline), ErrorCallbackT>);
+
+// Move-only, and no bigger than the handle it owns.
+static_assert(!std::is_copy_constructible_v<SerialPort>);
+static_assert(!std::is_copy_assignable_v<SerialPort>);
+static_assert(std::is_nothrow_move_constructible_v<SerialPort>);
+static_assert(std::is_nothrow_move_assignable_v<SerialPort>);
+static_assert(sizeof(SerialPort) == sizeof(std::int64_t));
+
+// Buffers: spans, arrays and vectors for reads; anything read-only is enough for writes.
+using Out = Result<std::size_t>;
+static_assert(std::is_same_v<decltype(std::declval<SerialPort &>().read(std::declval<std::span<std::byte>>(),
+                                                                         TimeoutMs{}, Multiplier{})),
+                             Out>);
+static_assert(std::is_same_v<decltype(std::declval<SerialPort &>().read(std::declval<std::array<std::byte, 8> &>(),
+                                                                         TimeoutMs{}, Multiplier{})),
+                             Out>);
+static_assert(std::is_same_v<decltype(std::declval<SerialPort &>().readFor(std::declval<std::vector<std::byte> &>(),
+                                                                            TotalTimeoutMs{})),
+                             Out>);
+static_assert(std::is_same_v<decltype(std::declval<SerialPort &>().write(
+                                 std::declval<const std::vector<std::byte> &>(), TimeoutMs{}, Multiplier{})),
+                             Out>);
+
+// clang-format off
+template <typename Buffer, typename... Args>
+concept CanRead = requires(SerialPort &port, Buffer buffer, Args... args) { port.read(buffer, args...); };
+
+template <typename Buffer, typename... Args>
+concept CanReadFor = requires(SerialPort &port, Buffer buffer, Args... args) { port.readFor(buffer, args...); };
+// clang-format on
+
+static_assert(CanRead<std::span<std::byte>, TimeoutMs, Multiplier>);
+// Read-only storage cannot be a read target.
+static_assert(!CanRead<std::span<const std::byte>, TimeoutMs, Multiplier>);
+// Timeouts are strong types: raw ints and swapped per-byte / total budgets do not compile.
+static_assert(!CanRead<std::span<std::byte>, int, int>);
+static_assert(!CanRead<std::span<std::byte>, Multiplier, TimeoutMs>);
+static_assert(CanReadFor<std::span<std::byte>, TotalTimeoutMs>);
+static_assert(!CanReadFor<std::span<std::byte>, TimeoutMs>);
+
+static_assert(detail::serial_port::clampSize(0) == 0);
+static_assert(detail::serial_port::clampSize(std::size_t{1} << 40U) == INT_MAX);
+
+} // namespace cpp_core::tests::serial_port
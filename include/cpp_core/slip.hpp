@@ -0,0 +1,209 @@
+#pragma once
+
+#include "byte_search.hpp"
+#include "framing.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+
+namespace cpp_core
+{
+
+namespace detail::slip
+{
+
+// RFC 1055 special characters.
+inline constexpr std::byte kEnd{0xC0};
+inline constexpr std::byte kEsc{0xDB};
+inline constexpr std::byte kEscEnd{0xDC};
+inline constexpr std::byte kEscEsc{0xDD};
+
+// Bound the two-byte scan so a distant special byte does not make every run rescan the whole input.
+inline constexpr std::size_t kScanWindow = 256;
+
+// Length of the leading run of @p data free of END and ESC.
+constexpr auto plainRun(std::span<const std::byte> data) noexcept -> std::size_t
+{
+    const auto window = data.first(std::min(data.size(), kScanWindow));
+    return std::min({findByte(window, kEnd), findByte(window, kEsc), window.size()});
+}
+
+} // namespace detail::slip
+
+// Worst-case encoded size of a @p size byte frame with leading and trailing END.
+[[nodiscard]] constexpr auto slipMaxEncodedSize(std::size_t size) noexcept -> std::size_t
+{
+    return (2 * size) + 2;
+}
+
+/**
+ * Streaming SLIP encoder (RFC 1055). Stateless between calls, so a frame may be fed in any number of
+ * chunks and encode() stops early rather than split an escape pair when @p output runs out.
+ * begin() writes the optional leading END that flushes line noise at the receiver.
+ */
+class SlipEncoder
+{
+  public:
+    constexpr auto begin(std::span<std::byte> output) const noexcept -> CodecProgress
+    {
+        return writeEnd(output);
+    }
+
+    constexpr auto encode(std::span<const std::byte> input, std::span<std::byte> output) const noexcept
+        -> CodecProgress
+    {
+        std::size_t in = 0;
+        std::size_t out = 0;
+        while (in < input.size() && out < output.size())
+        {
+            const auto run =
+                std::min(detail::slip::plainRun(input.subspan(in)), output.size() - out);
+            std::copy_n(input.begin() + static_cast<std::ptrdiff_t>(in), run,
+                        output.begin() + static_cast<std::ptrdiff_t>(out));
+            in += run;
+            out += run;
+            if (in == input.size() || output.size() - out < 2)
+            {
+                break;
+            }
+            const auto special = input[in++];
+            if (special != detail::slip::kEnd && special != detail::slip::kEsc)
+            {
+                // Run was cut by the scan window, not by a special byte.
+                output[out++] = special;
+                continue;
+            }
+            output[out++] = detail::slip::kEsc;
+            output[out++] = special == detail::slip::kEnd ? detail::slip::kEscEnd : detail::slip::kEscEsc;
+        }
+        return {.consumed = in, .produced = out};
+    }
+
+    constexpr auto finish(std::span<std::byte> output) const noexcept -> CodecProgress
+    {
+        return writeEnd(output);
+    }
+
+  private:
+    static constexpr auto writeEnd(std::span<std::byte> output) noexcept -> CodecProgress
+    {
+        if (output.empty())
+        {
+            return {.consumed = 0, .produced = 0};
+        }
+        output[0] = detail::slip::kEnd;
+        return {.consumed = 0, .produced = 1};
+    }
+};
+
+/**
+ * Streaming SLIP decoder. Frames may span chunk boundaries, including an ESC split from its follower.
+ * Empty frames (back-to-back END) are skipped; an invalid escape or a frame larger than the caller's
+ * buffer reports kError and drops input up to the next END. See FrameProgress for the call loop.
+ */
+class SlipDecoder
+{
+  public:
+    // Size of the frame reported by the last kFrame result.
+    [[nodiscard]] constexpr auto frameSize() const noexcept -> std::size_t
+    {
+        return frame_size_;
+    }
+
+    constexpr auto decode(std::span<const std::byte> input, std::span<std::byte> frame) noexcept -> FrameProgress
+    {
+        if (frame_done_)
+        {
+            reset();
+        }
+        std::size_t in = 0;
+        while (in < input.size())
+        {
+            if (discarding_)
+            {
+                const auto end = findByte(input.subspan(in), detail::slip::kEnd);
+                if (end == kNotFound)
+                {
+                    return {.status = FrameStatus::kNeedMore, .consumed = input.size()};
+                }
+                in += end + 1;
+                reset();
+                continue;
+            }
+            if (escaped_)
+            {
+                const auto code = input[in++];
+                escaped_ = false;
+                if (code == detail::slip::kEnd)
+                {
+                    // END right after ESC: the frame is corrupt, but the END already resynchronises.
+                    reset();
+                    return {.status = FrameStatus::kError, .consumed = in};
+                }
+                if (code != detail::slip::kEscEnd && code != detail::slip::kEscEsc)
+                {
+                    return fail(in);
+                }
+                if (frame_size_ == frame.size())
+                {
+                    return fail(in);
+                }
+                frame[frame_size_++] = code == detail::slip::kEscEnd ? detail::slip::kEnd : detail::slip::kEsc;
+                continue;
+            }
+            const auto run = detail::slip::plainRun(input.subspan(in));
+            if (run > frame.size() - frame_size_)
+            {
+                return fail(in);
+            }
+            std::copy_n(input.begin() + static_cast<std::ptrdiff_t>(in), run,
+                        frame.begin() + static_cast<std::ptrdiff_t>(frame_size_));
+            frame_size_ += run;
+            in += run;
+            if (in == input.size())
+            {
+                break;
+            }
+            const auto special = input[in];
+            if (special == detail::slip::kEsc)
+            {
+                escaped_ = true;
+                ++in;
+            }
+            else if (special == detail::slip::kEnd)
+            {
+                ++in;
+                if (frame_size_ != 0)
+                {
+                    frame_done_ = true;
+                    return {.status = FrameStatus::kFrame, .consumed = in};
+                }
+            }
+        }
+        return {.status = FrameStatus::kNeedMore, .consumed = in};
+    }
+
+    constexpr auto reset() noexcept -> void
+    {
+        frame_size_ = 0;
+        escaped_ = false;
+        discarding_ = false;
+        frame_done_ = false;
+    }
+
+  private:
+    constexpr auto fail(std::size_t consumed) noexcept -> FrameProgress
+    {
+        reset();
+        discarding_ = true;
+        return {.status = FrameStatus::kError, .consumed = consumed};
+    }
+
+    std::size_t frame_size_{0};
+    bool escaped_{false};
+    bool discarding_{false};
+    bool frame_done_{false};
+};
+
+} // namespace cpp_core
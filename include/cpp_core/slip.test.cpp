@@ -0,0 +1,107 @@
+#include "cpp_core/slip.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+
+namespace cpp_core::tests::slip
+{
+
+template <std::size_t N> constexpr auto bytes(const std::array<int, N> &values) -> std::array<std::byte, N>
+{
+    std::array<std::byte, N> out{};
+    std::ranges::transform(values, out.begin(), [](int value) { return static_cast<std::byte>(value); });
+    return out;
+}
+
+constexpr auto kRaw = bytes<6>({0x01, 0xC0, 0x02, 0xDB, 0xDB, 0x03});
+constexpr auto kEncoded = bytes<11>({0xC0, 0x01, 0xDB, 0xDC, 0x02, 0xDB, 0xDD, 0xDB, 0xDD, 0x03, 0xC0});
+
+// Encode kRaw through an output window of @p out_chunk bytes at a time; an escape pair needs two.
+consteval auto encodesThroughWindow(std::size_t out_chunk) -> bool
+{
+    const SlipEncoder encoder;
+    std::array<std::byte, slipMaxEncodedSize(kRaw.size())> out{};
+    std::size_t produced = encoder.begin(out).produced;
+    std::span<const std::byte> rest = kRaw;
+    while (!rest.empty())
+    {
+        const auto window = std::span(out).subspan(produced, std::min(out_chunk, out.size() - produced));
+        const auto step = encoder.encode(rest, window);
+        rest = rest.subspan(step.consumed);
+        produced += step.produced;
+    }
+    produced += encoder.finish(std::span(out).subspan(produced)).produced;
+    return produced == kEncoded.size() && std::ranges::equal(std::span(out).first(produced), kEncoded);
+}
+
+// Decode kEncoded fed @p chunk bytes at a time, so ESC is split from its follower for chunk == 1.
+consteval auto decodesInChunks(std::size_t chunk) -> bool
+{
+    SlipDecoder decoder;
+    std::array<std::byte, 8> frame{};
+    int frames = 0;
+    bool match = false;
+    for (std::size_t offset = 0; offset < kEncoded.size(); offset += chunk)
+    {
+        auto part = std::span(kEncoded).subspan(offset, std::min(chunk, kEncoded.size() - offset));
+        while (!part.empty())
+        {
+            const auto step = decoder.decode(part, frame);
+            part = part.subspan(step.consumed);
+            if (step.status == FrameStatus::kFrame)
+            {
+                ++frames;
+                match = std::ranges::equal(std::span(frame).first(decoder.frameSize()), kRaw);
+            }
+        }
+    }
+    return frames == 1 && match;
+}
+
+consteval auto resynchronisesAfterErrors() -> bool
+{
+    // Invalid escape, then an oversized frame, then a good one.
+    const auto stream = bytes<12>({0x11, 0xDB, 0x22, 0x33, 0xC0, 0x01, 0x02, 0x03, 0x04, 0xC0, 0x44, 0xC0});
+    SlipDecoder decoder;
+    std::array<std::byte, 3> frame{};
+    std::span<const std::byte> rest = stream;
+    const auto invalid = decoder.decode(rest, frame);
+    rest = rest.subspan(invalid.consumed);
+    const auto oversized = decoder.decode(rest, frame);
+    rest = rest.subspan(oversized.consumed);
+    const auto good = decoder.decode(rest, frame);
+    return invalid.status == FrameStatus::kError && invalid.consumed == 3 && oversized.status == FrameStatus::kError
+           && good.status == FrameStatus::kFrame && decoder.frameSize() == 1 && frame[0] == std::byte{0x44};
+}
+
+// Plain runs longer than the scan window must pass through untouched.
+consteval auto copiesLongRuns() -> bool
+{
+    std::array<std::byte, 600> raw{};
+    std::ranges::fill(raw, std::byte{'a'});
+    raw[300] = std::byte{0xC0};
+    std::array<std::byte, slipMaxEncodedSize(600)> out{};
+    const auto step = SlipEncoder{}.encode(raw, out);
+    std::array<std::byte, 600> frame{};
+    SlipDecoder decoder;
+    const auto body = decoder.decode(std::span(out).first(step.produced), frame);
+    const auto end = bytes<1>({0xC0});
+    const auto done = decoder.decode(end, frame);
+    return step.consumed == 600 && step.produced == 601 && body.status == FrameStatus::kNeedMore
+           && done.status == FrameStatus::kFrame
+           && std::ranges::equal(std::span(frame).first(decoder.frameSize()), raw);
+}
+
+static_assert(slipMaxEncodedSize(3) == 8);
+static_assert(encodesThroughWindow(kEncoded.size()));
+static_assert(encodesThroughWindow(2));
+static_assert(encodesThroughWindow(3));
+static_assert(decodesInChunks(kEncoded.size()));
+static_assert(decodesInChunks(1));
+static_assert(decodesInChunks(4));
+static_assert(resynchronisesAfterErrors());
+static_assert(copiesLongRuns());
+
+} // namespace cpp_core::tests::slip
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "interface/serial_get_stats.h"
+#include "status_code.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace cpp_core
+{
+
+/**
+ * Per-handle software counters behind serialGetStats().
+ * All updates are relaxed atomic increments, so recording on the data path costs one uncontended
+ * add and never takes a lock. Queue depths and driver line-error counters are filled in by the
+ * binding after snapshot().
+ *   const int result = readImpl(...);
+ *   handle.stats.recordRead(result);
+ *   return result;
+ */
+class StatsCounters
+{
+  public:
+    // Account one read-type call from its C return value (bytes, 0 on timeout or negative status).
+    auto recordRead(std::int64_t result) noexcept -> void
+    {
+        add(read_calls_, 1);
+        record(result, in_bytes_total_, read_timeouts_, read_aborts_, StatusCode::Io::kAbortReadError);
+    }
+
+    // Account one write-type call from its C return value (bytes, 0 on timeout or negative status).
+    auto recordWrite(std::int64_t result) noexcept -> void
+    {
+        add(write_calls_, 1);
+        record(result, out_bytes_total_, write_timeouts_, write_aborts_, StatusCode::Io::kAbortWriteError);
+    }
+
+    [[nodiscard]] auto inBytesTotal() const noexcept -> std::int64_t
+    {
+        return in_bytes_total_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] auto outBytesTotal() const noexcept -> std::int64_t
+    {
+        return out_bytes_total_.load(std::memory_order_relaxed);
+    }
+
+    // Fill the software counters of @p out; queue depths and line-error counters are left untouched.
+    auto snapshot(SerialStats &out) const noexcept -> void
+    {
+        out.in_bytes_total = inBytesTotal();
+        out.out_bytes_total = outBytesTotal();
+        out.read_calls = read_calls_.load(std::memory_order_relaxed);
+        out.write_calls = write_calls_.load(std::memory_order_relaxed);
+        out.read_timeouts = read_timeouts_.load(std::memory_order_relaxed);
+        out.write_timeouts = write_timeouts_.load(std::memory_order_relaxed);
+        out.read_aborts = read_aborts_.load(std::memory_order_relaxed);
+        out.write_aborts = write_aborts_.load(std::memory_order_relaxed);
+    }
+
+  private:
+    using Counter = std::atomic<std::int64_t>;
+
+    static auto add(Counter &counter, std::int64_t amount) noexcept -> void
+    {
+        counter.fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    static auto record(std::int64_t result, Counter &bytes, Counter &timeouts, Counter &aborts,
+                       StatusCodeValue abort_code) noexcept -> void
+    {
+        if (result > 0)
+        {
+            add(bytes, result);
+        }
+        else if (result == 0)
+        {
+            add(timeouts, 1);
+        }
+        else if (result == abort_code)
+        {
+            add(aborts, 1);
+        }
+    }
+
+    Counter in_bytes_total_{0};
+    Counter out_bytes_total_{0};
+    Counter read_calls_{0};
+    Counter write_calls_{0};
+    Counter read_timeouts_{0};
+    Counter write_timeouts_{0};
+    Counter read_aborts_{0};
+    Counter write_aborts_{0};
+};
+
+} // namespace cpp_core
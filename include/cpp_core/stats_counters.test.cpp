@@ -0,0 +1,44 @@
+#include "cpp_core/stats_counters.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace cpp_core::tests::stats_counters
+{
+
+// serialGetStats() copies the snapshot across the C ABI: fourteen int64 fields, in declaration order.
+static_assert(std::is_standard_layout_v<SerialStats> && std::is_trivially_copyable_v<SerialStats>);
+static_assert(sizeof(SerialStats) == 14 * sizeof(std::int64_t));
+static_assert(offsetof(SerialStats, in_bytes_total) == 0 * sizeof(std::int64_t));
+static_assert(offsetof(SerialStats, out_bytes_total) == 1 * sizeof(std::int64_t));
+static_assert(offsetof(SerialStats, in_bytes_waiting) == 2 * sizeof(std::int64_t));
+static_assert(offsetof(SerialStats, out_bytes_waiting) == 3 * sizeof(std::int64_t));
+static_assert(offsetof(SerialStats, overrun_errors) == 4 * sizeof(std::int64_t));
+static_assert(offsetof(SerialStats, framing_errors) == 5 * sizeof(std::int64_t));
+static_assert(offsetof(SerialStats, parity_errors) == 6 * sizeof(std::int64_t));
+static_assert(offsetof(SerialStats, breaks) == 7 * sizeof(std::int64_t));
+static_assert(offsetof(SerialStats, read_calls) == 8 * sizeof(std::int64_t));
+static_assert(offsetof(SerialStats, write_calls) == 9 * sizeof(std::int64_t));
+static_assert(offsetof(SerialStats, read_timeouts) == 10 * sizeof(std::int64_t));
+static_assert(offsetof(SerialStats, write_timeouts) == 11 * sizeof(std::int64_t));
+static_assert(offsetof(SerialStats, read_aborts) == 12 * sizeof(std::int64_t));
+static_assert(offsetof(SerialStats, write_aborts) == 13 * sizeof(std::int64_t));
+
+// One lock-free counter per software field snapshot() fills: the two byte totals plus the six call
+// counters. Queue depths and the four line-error counters come from the binding instead.
+static_assert(std::atomic<std::int64_t>::is_always_lock_free);
+static_assert(sizeof(StatsCounters) == 8 * sizeof(std::atomic<std::int64_t>));
+static_assert(std::is_default_constructible_v<StatsCounters>);
+static_assert(!std::is_copy_constructible_v<StatsCounters> && !std::is_copy_assignable_v<StatsCounters>);
+
+// Recording sits on the data path and must never throw.
+static_assert(noexcept(std::declval<StatsCounters &>().recordRead(0)));
+static_assert(noexcept(std::declval<StatsCounters &>().recordWrite(0)));
+static_assert(noexcept(std::declval<const StatsCounters &>().snapshot(std::declval<SerialStats &>())));
+static_assert(std::is_same_v<decltype(std::declval<const StatsCounters &>().inBytesTotal()), std::int64_t>);
+static_assert(std::is_same_v<decltype(std::declval<const StatsCounters &>().outBytesTotal()), std::int64_t>);
+
+} // namespace cpp_core::tests::stats_counters
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "interface/serial_status_table.h"
+#include "status_code.h"
+
+#include <meta>
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace cpp_core
+{
+
+namespace detail::status_table
+{
+
+// Every Code<> constant of every category nested in StatusCode, in declaration order.
+consteval auto codeMembers() -> std::vector<std::meta::info>
+{
+    const auto context = std::meta::access_context::unprivileged();
+    std::vector<std::meta::info> codes;
+    for (const auto category : std::meta::members_of(^^StatusCode, context))
+    {
+        if (!std::meta::is_type(category) || !std::meta::is_class_type(category))
+        {
+            continue;
+        }
+        for (const auto member : std::meta::static_data_members_of(category, context))
+        {
+            const auto type = std::meta::remove_cv(std::meta::type_of(member));
+            if (std::meta::has_template_arguments(type)
+                && std::meta::template_of(type) == ^^status_codes::detail::Code)
+            {
+                codes.push_back(member);
+            }
+        }
+    }
+    return codes;
+}
+
+inline constexpr auto kCodeMembers = std::define_static_array(codeMembers());
+
+template <std::size_t... Index>
+consteval auto makeEntries(std::index_sequence<Index...>) -> std::array<StatusInfo, sizeof...(Index) + 1>
+{
+    return {{
+        StatusInfo{.code = StatusCode::kSuccess, .name = "Success", .category = "None"},
+        StatusInfo{
+            .code = [:kCodeMembers[Index]:].value(),
+            .name = std::define_static_string([:kCodeMembers[Index]:].name()),
+            .category = std::define_static_string([:kCodeMembers[Index]:].category()),
+        }...,
+    }};
+}
+
+inline constexpr auto kEntries = makeEntries(std::make_index_sequence<kCodeMembers.size()>{});
+
+consteval auto denseSize() -> std::size_t
+{
+    StatusCodeValue lowest = 0;
+    for (const auto &entry : kEntries)
+    {
+        lowest = entry.code < lowest ? entry.code : lowest;
+    }
+    return static_cast<std::size_t>(-lowest) + 1;
+}
+
+// Indexed by -code; unused slots keep name == nullptr.
+consteval auto makeDense() -> std::array<StatusInfo, denseSize()>
+{
+    std::array<StatusInfo, denseSize()> dense{};
+    for (const auto &entry : kEntries)
+    {
+        dense[static_cast<std::size_t>(-entry.code)] = entry;
+    }
+    return dense;
+}
+
+consteval auto codesAreUnique() -> bool
+{
+    std::size_t defined = 0;
+    for (const auto &slot : makeDense())
+    {
+        defined += slot.name != nullptr ? 1 : 0;
+    }
+    return defined == kEntries.size();
+}
+
+static_assert(codesAreUnique(), "Two StatusCode constants share a numeric value");
+
+inline constexpr auto kDense = makeDense();
+
+} // namespace detail::status_table
+
+inline constexpr const char *kUnknownStatusName = "Unknown";
+
+/**
+ * Every status code as `{code, name, category}`: kSuccess first, then each category of StatusCode in
+ * declaration order. Generated by reflection, so adding a Code<> to status_code.h is all it takes.
+ * Backs serialStatusTable():
+ *   const auto table = statusTable();
+ *   std::copy_n(table.begin(), std::min<std::size_t>(capacity, table.size()), out);
+ *   return static_cast<int>(table.size());
+ */
+[[nodiscard]] constexpr auto statusTable() noexcept -> std::span<const StatusInfo>
+{
+    return detail::status_table::kEntries;
+}
+
+// O(1) lookup by numeric value; nullptr if @p code is not a status code.
+[[nodiscard]] constexpr auto statusInfo(StatusCodeValue code) noexcept -> const StatusInfo *
+{
+    const auto &dense = detail::status_table::kDense;
+    if (code > 0 || code < -static_cast<StatusCodeValue>(dense.size() - 1))
+    {
+        return nullptr;
+    }
+    const auto &slot = dense[static_cast<std::size_t>(-code)];
+    return slot.name != nullptr ? &slot : nullptr;
+}
+
+// Backs serialStatusName(): the code's name, or kUnknownStatusName.
+[[nodiscard]] constexpr auto statusName(StatusCodeValue code) noexcept -> const char *
+{
+    const auto *info = statusInfo(code);
+    return info != nullptr ? info->name : kUnknownStatusName;
+}
+
+} // namespace cpp_core
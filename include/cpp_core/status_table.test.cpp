@@ -0,0 +1,42 @@
+#include "cpp_core/status_table.hpp"
+
+#include <limits>
+#include <string_view>
+
+namespace cpp_core::tests::status_table
+{
+
+constexpr auto nameOf(StatusCodeValue code) -> std::string_view
+{
+    return statusName(code);
+}
+
+constexpr auto categoryOf(StatusCodeValue code) -> std::string_view
+{
+    const auto *info = statusInfo(code);
+    return info != nullptr ? info->category : "";
+}
+
+// kSuccess + 6 Configuration + 3 Connection + 7 Io + 6 Control + 1 Monitor.
+static_assert(statusTable().size() == 24);
+static_assert(statusTable().front().code == StatusCode::kSuccess);
+static_assert(statusTable()[1].code == StatusCode::Configuration::kSetBaudrateError);
+static_assert(statusTable().back().code == StatusCode::Monitor::kMonitorError);
+
+static_assert(nameOf(StatusCode::kSuccess) == "Success");
+static_assert(nameOf(StatusCode::Configuration::kSetTimeoutError) == "SetTimeoutError");
+static_assert(nameOf(StatusCode::Io::kReadError) == "ReadError");
+static_assert(nameOf(StatusCode::Io::kClearBufferOutError) == "ClearBufferOutError");
+static_assert(nameOf(StatusCode::Control::kSetStateError) == "SetStateError");
+static_assert(categoryOf(StatusCode::Connection::kInvalidHandleError) == "Connection");
+static_assert(categoryOf(StatusCode::Monitor::kMonitorError) == "Monitor");
+
+// Gaps inside and beyond the dense range, positive byte counts and the most negative value.
+static_assert(statusInfo(-150) == nullptr);
+static_assert(statusInfo(-307) == nullptr);
+static_assert(statusInfo(-9999) == nullptr);
+static_assert(statusInfo(12) == nullptr);
+static_assert(statusInfo(std::numeric_limits<StatusCodeValue>::min()) == nullptr);
+static_assert(nameOf(-150) == "Unknown");
+
+} // namespace cpp_core::tests::status_table
@@ -70,11 +70,16 @@ struct TimeoutMsTag
 struct MultiplierTag
 {
 };
+struct TotalTimeoutMsTag
+{
+};
 
 using Baudrate = StrongInt<BaudrateTag>;
 using DataBits = StrongInt<DataBitsTag>;
 using TimeoutMs = StrongInt<TimeoutMsTag>;
 using Multiplier = StrongInt<MultiplierTag>;
+// Budget for a whole call (serialReadFor() and friends), as opposed to the per-byte TimeoutMs.
+using TotalTimeoutMs = StrongInt<TotalTimeoutMsTag>;
 
 // Parity & StopBits enums
 
@@ -98,6 +103,39 @@ enum class FlowControl : int
     kXonXoff = 2,
 };
 
+// Readiness bits used in cpp_core::PollEntry::events / revents (see serialPoll()).
+enum class PollEvent : int
+{
+    kNone = 0,
+    kReadable = 1,
+    kWritable = 2,
+    kError = 4,
+    kHangup = 8,
+    kInvalid = 16,
+};
+
+// Operation codes for cpp_core::QueueSubmission::op (see serialSubmit()).
+enum class QueueOp : int
+{
+    kRead = 0,
+    kWrite = 1,
+    kDrain = 2,
+    kReadLine = 3,
+    kReadUntil = 4,
+    kReadUntilSequence = 5,
+};
+
+// Operation selectors for serialGetLatencyHistogram(). kReadUntil covers every delimiter read (line, byte, sequence).
+enum class LatencyOp : int
+{
+    kRead = 0,
+    kWrite = 1,
+    kReadUntil = 2,
+    kDrain = 3,
+    kOpen = 4,
+    kClose = 5,
+};
+
 template <typename Enum>
 requires std::is_enum_v<Enum>
 [[nodiscard]] constexpr auto toInt(Enum value) noexcept -> int
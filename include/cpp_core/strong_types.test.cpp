@@ -9,5 +9,12 @@ static_assert((DataBits{8} - DataBits{3}).get() == 5);
 static_assert(toInt(Parity::kOdd) == 2);
 static_assert(toInt(StopBits::kTwo) == 2);
 static_assert(toInt(FlowControl::kXonXoff) == 2);
+static_assert(toInt(PollEvent::kReadable) == 1);
+static_assert(toInt(PollEvent::kWritable) == 2);
+static_assert(toInt(PollEvent::kInvalid) == 16);
+static_assert(toInt(QueueOp::kDrain) == 2);
+static_assert(toInt(QueueOp::kReadUntilSequence) == 5);
+static_assert(toInt(LatencyOp::kReadUntil) == 2);
+static_assert(toInt(LatencyOp::kClose) == 5);
 
 } // namespace cpp_core::tests::strong_types
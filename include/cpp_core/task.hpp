@@ -0,0 +1,220 @@
+#pragma once
+
+#include <cassert>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace cpp_core
+{
+
+template <typename T = void> class Task;
+
+namespace detail::task
+{
+
+struct PromiseBase
+{
+    std::coroutine_handle<> continuation;
+    std::exception_ptr exception;
+
+    struct FinalAwaiter
+    {
+        [[nodiscard]] static auto await_ready() noexcept -> bool
+        {
+            return false;
+        }
+
+        // Symmetric transfer back to the awaiter; top-level tasks stay suspended for their owner to destroy.
+        template <typename Promise>
+        [[nodiscard]] static auto await_suspend(std::coroutine_handle<Promise> self) noexcept -> std::coroutine_handle<>
+        {
+            const auto continuation = self.promise().continuation;
+            return continuation ? continuation : std::noop_coroutine();
+        }
+
+        static auto await_resume() noexcept -> void
+        {
+        }
+    };
+
+    [[nodiscard]] static auto initial_suspend() noexcept -> std::suspend_always
+    {
+        return {};
+    }
+
+    [[nodiscard]] static auto final_suspend() noexcept -> FinalAwaiter
+    {
+        return {};
+    }
+
+    auto unhandled_exception() noexcept -> void
+    {
+        exception = std::current_exception();
+    }
+
+    auto rethrowIfFailed() const -> void
+    {
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+};
+
+template <typename T> struct Promise : PromiseBase
+{
+    std::optional<T> value;
+
+    [[nodiscard]] auto get_return_object() noexcept -> Task<T>;
+
+    template <typename U>
+    requires std::is_convertible_v<U &&, T>
+    auto return_value(U &&result) -> void
+    {
+        value.emplace(std::forward<U>(result));
+    }
+
+    [[nodiscard]] auto take() -> T
+    {
+        rethrowIfFailed();
+        return std::move(*value);
+    }
+};
+
+template <> struct Promise<void> : PromiseBase
+{
+    [[nodiscard]] auto get_return_object() noexcept -> Task<void>;
+
+    auto return_void() noexcept -> void
+    {
+    }
+
+    auto take() const -> void
+    {
+        rethrowIfFailed();
+    }
+};
+
+} // namespace detail::task
+
+/**
+ * Lazily started coroutine producing T. `co_await task` starts it and resumes the awaiter when it
+ * finishes, by symmetric transfer, so long await chains do not grow the stack. Exceptions escaping the
+ * body are rethrown at the co_await. Top-level tasks are run by IoContext::spawn().
+ *   auto readHeader(AsyncPort &port, std::span<std::byte> out) -> Task<Status>;
+ *   if (auto header = co_await readHeader(port, buffer); !header) { co_return forwardUnexpected(std::move(header)); }
+ */
+template <typename T> class [[nodiscard]] Task
+{
+  public:
+    using promise_type = detail::task::Promise<T>;
+    using Handle = std::coroutine_handle<promise_type>;
+
+    Task() noexcept = default;
+
+    explicit Task(Handle handle) noexcept : handle_(handle)
+    {
+    }
+
+    Task(const Task &) = delete;
+    auto operator=(const Task &) -> Task & = delete;
+
+    Task(Task &&other) noexcept : handle_(std::exchange(other.handle_, {}))
+    {
+    }
+
+    auto operator=(Task &&other) noexcept -> Task &
+    {
+        if (this != &other)
+        {
+            destroy();
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+
+    ~Task()
+    {
+        destroy();
+    }
+
+    [[nodiscard]] auto valid() const noexcept -> bool
+    {
+        return static_cast<bool>(handle_);
+    }
+
+    [[nodiscard]] auto done() const noexcept -> bool
+    {
+        return !handle_ || handle_.done();
+    }
+
+    // The coroutine to resume to start the task; used by executors.
+    [[nodiscard]] auto coroutine() const noexcept -> std::coroutine_handle<>
+    {
+        return handle_;
+    }
+
+    // Result of a finished task; rethrows an exception that escaped its body.
+    [[nodiscard]] auto result() -> decltype(auto)
+    {
+        return handle_.promise().take();
+    }
+
+    // Awaiting an empty (default-constructed or moved-from) Task is a precondition violation.
+    auto operator co_await() && noexcept
+    {
+        assert(valid() && "co_await on an empty Task");
+        struct Awaiter
+        {
+            Handle handle;
+
+            [[nodiscard]] auto await_ready() const noexcept -> bool
+            {
+                return handle.done();
+            }
+
+            [[nodiscard]] auto await_suspend(std::coroutine_handle<> awaiting) noexcept -> std::coroutine_handle<>
+            {
+                handle.promise().continuation = awaiting;
+                return handle;
+            }
+
+            auto await_resume() -> T
+            {
+                return handle.promise().take();
+            }
+        };
+        return Awaiter{handle_};
+    }
+
+  private:
+    auto destroy() noexcept -> void
+    {
+        if (handle_)
+        {
+            handle_.destroy();
+        }
+    }
+
+    Handle handle_;
+};
+
+namespace detail::task
+{
+
+template <typename T> auto Promise<T>::get_return_object() noexcept -> Task<T>
+{
+    return Task<T>{std::coroutine_handle<Promise>::from_promise(*this)};
+}
+
+inline auto Promise<void>::get_return_object() noexcept -> Task<void>
+{
+    return Task<void>{std::coroutine_handle<Promise>::from_promise(*this)};
+}
+
+} // namespace detail::task
+
+} // namespace cpp_core
@@ -0,0 +1,339 @@
+#pragma once
+
+#include "status_table.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+// USDT probes cpp_core:call_entry(name, handle) and cpp_core:call_return(name, handle, result) on every
+// traced call when <sys/sdt.h> is available; a probe is a single nop until a tracer attaches. Define
+// CPP_CORE_NO_USDT to leave them out.
+#if !defined(CPP_CORE_NO_USDT) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define CPP_CORE_HAS_USDT 1
+#endif
+#endif
+#ifndef CPP_CORE_HAS_USDT
+#define CPP_CORE_HAS_USDT 0
+#endif
+
+#if CPP_CORE_HAS_USDT
+#define CPP_CORE_PROBE_ENTRY(name, handle) STAP_PROBE2(cpp_core, call_entry, name, handle)
+#define CPP_CORE_PROBE_RETURN(name, handle, result) STAP_PROBE3(cpp_core, call_return, name, handle, result)
+#else
+#define CPP_CORE_PROBE_ENTRY(name, handle) static_cast<void>(0)
+#define CPP_CORE_PROBE_RETURN(name, handle, result) static_cast<void>(0)
+#endif
+
+/**
+ * Trace an exported function: wraps its body so the call fires the USDT probes and, while
+ * serialSetTracing() is on, lands in the calling thread's trace ring under the function's name.
+ * With tracing off the only added work is one relaxed load and a branch predicted not taken.
+ *   auto serialDrain(int64_t handle, ErrorCallbackT error_callback) -> int
+ *   {
+ *       return CPP_CORE_TRACED(handle, [&] { return drainImpl(handle, error_callback); });
+ *   }
+ */
+#define CPP_CORE_TRACED(handle, body) ::cpp_core::trace::traced(__func__, (handle), (body))
+
+namespace cpp_core::trace
+{
+
+using Clock = std::chrono::steady_clock;
+
+// One finished call. `size` is the call's non-negative result (bytes, or the new handle for serialOpen()),
+// `status` its negative result or 0. `name` points to the exported function's __func__.
+struct Record
+{
+    std::int64_t start_ns;
+    std::int64_t duration_ns;
+    std::int64_t handle;
+    std::int64_t size;
+    const char *name;
+    std::int32_t status;
+    std::uint32_t thread;
+};
+
+inline constexpr std::size_t kRingRecords = 4096;
+
+/**
+ * Fixed-size per-thread record ring: the owning thread overwrites the oldest record without
+ * waiting, collect() copies a consistent suffix from any thread. Each slot is a seqlock: its
+ * sequence is odd while a push writes the fields and 2 * (index + 1) once record `index` is whole.
+ * Fields are accessed through relaxed atomic_ref, so a concurrent overwrite is a detected loss, not
+ * a data race, on weakly ordered CPUs as well.
+ */
+class Ring
+{
+  public:
+    // Owner thread only.
+    auto push(const Record &record) noexcept -> void
+    {
+        const auto head = head_.load(std::memory_order_relaxed);
+        auto &slot = slots_[head % kRingRecords];
+        slot.sequence.store((2 * head) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        store(slot.record.start_ns, record.start_ns);
+        store(slot.record.duration_ns, record.duration_ns);
+        store(slot.record.handle, record.handle);
+        store(slot.record.size, record.size);
+        store(slot.record.name, record.name);
+        store(slot.record.status, record.status);
+        store(slot.record.thread, record.thread);
+        slot.sequence.store(2 * (head + 1), std::memory_order_release);
+        head_.store(head + 1, std::memory_order_release);
+    }
+
+    // Append the records pushed since the last reset() that are still in the ring. A slot the owner is
+    // writing, or rewrote while it was copied, no longer holds the record wanted; it and everything
+    // copied before it are dropped, so the result stays a gap-free suffix.
+    auto collect(std::vector<Record> &out) const -> void
+    {
+        const auto head = head_.load(std::memory_order_acquire);
+        const auto first = std::max(start_.load(std::memory_order_relaxed), oldest(head));
+        const auto copied_from = out.size();
+        for (auto index = first; index < head; ++index)
+        {
+            const auto &slot = slots_[index % kRingRecords];
+            const auto sequence = slot.sequence.load(std::memory_order_acquire);
+            if (sequence != 2 * (index + 1))
+            {
+                out.resize(copied_from);
+                continue;
+            }
+            const Record copy{load(slot.record.start_ns), load(slot.record.duration_ns), load(slot.record.handle),
+                              load(slot.record.size), load(slot.record.name), load(slot.record.status),
+                              load(slot.record.thread)};
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != sequence)
+            {
+                out.resize(copied_from);
+                continue;
+            }
+            out.push_back(copy);
+        }
+    }
+
+    // Forget everything pushed so far; callable from any thread.
+    auto reset() noexcept -> void
+    {
+        start_.store(head_.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+
+  private:
+    static constexpr auto oldest(std::uint64_t head) noexcept -> std::uint64_t
+    {
+        return head > kRingRecords ? head - kRingRecords : 0;
+    }
+
+    template <typename T> static auto store(T &field, T value) noexcept -> void
+    {
+        std::atomic_ref<T>(field).store(value, std::memory_order_relaxed);
+    }
+
+    template <typename T> static auto load(const T &field) noexcept -> T
+    {
+        return std::atomic_ref<T>(const_cast<T &>(field)).load(std::memory_order_relaxed);
+    }
+
+    struct Slot
+    {
+        std::atomic<std::uint64_t> sequence{0};
+        Record record{};
+    };
+
+    std::array<Slot, kRingRecords> slots_{};
+    std::atomic<std::uint64_t> head_{0};
+    std::atomic<std::uint64_t> start_{0};
+};
+
+namespace detail
+{
+
+inline constinit std::atomic<bool> g_tracing{false};
+
+// Every ring ever handed out. Rings of exited threads are reused, so their records survive until
+// the next thread overwrites them and the number of rings is bounded by the peak thread count.
+class Registry
+{
+  public:
+    struct Lease
+    {
+        Ring *ring;
+        std::uint32_t thread;
+    };
+
+    static auto instance() -> Registry &
+    {
+        // Leaked: thread_local leases may be returned after static destruction has started.
+        static auto *registry = new Registry();
+        return *registry;
+    }
+
+    auto acquire() -> Lease
+    {
+        const std::scoped_lock lock(mutex_);
+        Ring *ring = nullptr;
+        if (!idle_.empty())
+        {
+            ring = idle_.back();
+            idle_.pop_back();
+        }
+        else
+        {
+            ring = rings_.emplace_back(std::make_unique<Ring>()).get();
+        }
+        return {ring, ++next_thread_};
+    }
+
+    auto release(Ring *ring) -> void
+    {
+        const std::scoped_lock lock(mutex_);
+        idle_.push_back(ring);
+    }
+
+    auto collect(std::vector<Record> &out) const -> void
+    {
+        const std::scoped_lock lock(mutex_);
+        for (const auto &ring : rings_)
+        {
+            ring->collect(out);
+        }
+    }
+
+    auto reset() -> void
+    {
+        const std::scoped_lock lock(mutex_);
+        for (const auto &ring : rings_)
+        {
+            ring->reset();
+        }
+    }
+
+  private:
+    Registry() = default;
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<Ring>> rings_;
+    std::vector<Ring *> idle_;
+    std::uint32_t next_thread_ = 0;
+};
+
+struct ThreadLease
+{
+    Registry::Lease lease{nullptr, 0};
+
+    ThreadLease() = default;
+    ThreadLease(const ThreadLease &) = delete;
+    auto operator=(const ThreadLease &) -> ThreadLease & = delete;
+
+    ~ThreadLease()
+    {
+        if (lease.ring != nullptr)
+        {
+            Registry::instance().release(lease.ring);
+        }
+    }
+};
+
+inline auto threadLease() -> const Registry::Lease &
+{
+    thread_local ThreadLease local;
+    if (local.lease.ring == nullptr)
+    {
+        local.lease = Registry::instance().acquire();
+    }
+    return local.lease;
+}
+
+[[nodiscard]] inline auto sinceEpochNs(Clock::time_point at) noexcept -> std::int64_t
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(at.time_since_epoch()).count();
+}
+
+template <typename Result>
+auto record(const char *name, std::int64_t handle, Clock::time_point start, Clock::time_point end, Result result)
+    -> void
+{
+    const auto &lease = threadLease();
+    const auto value = static_cast<std::int64_t>(result);
+    lease.ring->push(Record{sinceEpochNs(start), sinceEpochNs(end) - sinceEpochNs(start), handle,
+                            std::max<std::int64_t>(value, 0), name,
+                            static_cast<std::int32_t>(std::min<std::int64_t>(value, 0)), lease.thread});
+}
+
+} // namespace detail
+
+[[nodiscard]] inline auto enabled() noexcept -> bool
+{
+    return detail::g_tracing.load(std::memory_order_relaxed);
+}
+
+// Backs serialSetTracing(): turning tracing on starts a fresh capture.
+inline auto setEnabled(bool on) -> void
+{
+    if (on && !enabled())
+    {
+        detail::Registry::instance().reset();
+    }
+    detail::g_tracing.store(on, std::memory_order_relaxed);
+}
+
+// Implementation of CPP_CORE_TRACED(); @p body returns the exported function's C result.
+template <typename Body>
+auto traced(const char *name, std::int64_t handle, Body &&body) -> std::invoke_result_t<Body &>
+{
+    CPP_CORE_PROBE_ENTRY(name, handle);
+    if (!enabled()) [[likely]]
+    {
+        const auto result = body();
+        CPP_CORE_PROBE_RETURN(name, handle, result);
+        return result;
+    }
+    const auto start = Clock::now();
+    const auto result = body();
+    const auto end = Clock::now();
+    CPP_CORE_PROBE_RETURN(name, handle, result);
+    detail::record(name, handle, start, end, result);
+    return result;
+}
+
+/**
+ * Backs serialTraceDump(): every record still in the rings as Chrome trace-event JSON ("X" complete
+ * events, one track per thread), which chrome://tracing and ui.perfetto.dev open directly.
+ * Returns the number of events written.
+ */
+inline auto writeChromeTrace(std::FILE *out) -> std::size_t
+{
+    std::vector<Record> records;
+    detail::Registry::instance().collect(records);
+    std::ranges::sort(records, {}, &Record::start_ns);
+    const auto origin = records.empty() ? 0 : records.front().start_ns;
+
+    std::fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", out);
+    for (std::size_t i = 0; i < records.size(); ++i)
+    {
+        const auto &record = records[i];
+        std::fprintf(out,
+                     "%s\n{\"name\":\"%s\",\"cat\":\"cpp_core\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,"
+                     "\"dur\":%.3f,\"args\":{\"handle\":%lld,\"size\":%lld,\"status\":\"%s\"}}",
+                     i == 0 ? "" : ",", record.name, static_cast<unsigned>(record.thread),
+                     static_cast<double>(record.start_ns - origin) / 1000.0,
+                     static_cast<double>(record.duration_ns) / 1000.0, static_cast<long long>(record.handle),
+                     static_cast<long long>(record.size), statusName(record.status));
+    }
+    std::fputs("\n]}\n", out);
+    return records.size();
+}
+
+} // namespace cpp_core::trace
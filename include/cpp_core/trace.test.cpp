@@ -0,0 +1,23 @@
+#include "cpp_core/trace.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace cpp_core::tests::trace
+{
+
+using cpp_core::trace::Record;
+
+// Records are copied field by field out of rings other threads are writing; keep them small and flat.
+static_assert(std::is_trivially_copyable_v<Record>);
+static_assert(sizeof(Record) == 48);
+static_assert(cpp_core::trace::kRingRecords > 0 &&
+              (cpp_core::trace::kRingRecords & (cpp_core::trace::kRingRecords - 1)) == 0);
+
+// traced() hands back the body's result unchanged, whatever the exported function's return type.
+using IntBody = decltype([] { return 1; });
+using HandleBody = decltype([] { return std::int64_t{1}; });
+static_assert(std::is_same_v<decltype(cpp_core::trace::traced("f", 0, IntBody{})), int>);
+static_assert(std::is_same_v<decltype(cpp_core::trace::traced("f", 0, HandleBody{})), std::int64_t>);
+
+} // namespace cpp_core::tests::trace
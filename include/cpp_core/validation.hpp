@@ -1,10 +1,13 @@
 #pragma once
 
 #include "error_handling.hpp"
+#include "io_vec.h"
 #include "status_code.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <span>
 
 namespace cpp_core
 {
@@ -67,6 +70,42 @@ constexpr auto validateBuffer(const void *buffer, int buffer_size, Callback &&er
     return static_cast<Ret>(StatusCode::kSuccess);
 }
 
+// Upper bound for buffer_count in serialReadV/serialWriteV (matches IOV_MAX on Linux).
+inline constexpr int kMaxIoVecCount = 1024;
+
+/**
+ * Validate a scatter/gather descriptor array for serialReadV/serialWriteV.
+ * Empty entries are allowed, but the combined size must be > 0 and fit into the int return value.
+ */
+template <StatusConvertible Ret, ErrorCallback Callback>
+constexpr auto validateIoVec(const IoVec *buffers, int buffer_count, Callback &&error_callback) -> Ret
+{
+    if (buffers == nullptr || buffer_count <= 0 || buffer_count > kMaxIoVecCount)
+    {
+        return failMsg<Ret>(std::forward<Callback>(error_callback),
+                            static_cast<StatusCodeValue>(StatusCode::Io::kBufferError),
+                            "Invalid buffers or buffer_count");
+    }
+    std::int64_t total = 0;
+    for (const auto &entry : std::span(buffers, static_cast<std::size_t>(buffer_count)))
+    {
+        if (entry.size < 0 || (entry.size > 0 && entry.data == nullptr))
+        {
+            return failMsg<Ret>(std::forward<Callback>(error_callback),
+                                static_cast<StatusCodeValue>(StatusCode::Io::kBufferError),
+                                "Invalid buffer descriptor");
+        }
+        total += entry.size;
+    }
+    if (total <= 0 || total > std::numeric_limits<int>::max())
+    {
+        return failMsg<Ret>(std::forward<Callback>(error_callback),
+                            static_cast<StatusCodeValue>(StatusCode::Io::kBufferError),
+                            "Invalid total buffer size");
+    }
+    return static_cast<Ret>(StatusCode::kSuccess);
+}
+
 // Clamp timeout to non-negative.
 constexpr auto clampTimeout(int timeout_ms) -> int
 {
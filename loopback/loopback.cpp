@@ -0,0 +1,1964 @@
+#include "loopback.hpp"
+
+#include "cpp_core/byte_search.hpp"
+#include "cpp_core/scope_guard.hpp"
+#include "cpp_core/strong_types.hpp"
+
+#include <fcntl.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace cpp_core::loopback
+{
+
+namespace
+{
+
+auto deadlineAfter(Clock::time_point now, std::int64_t timeout_ms) -> Clock::time_point
+{
+    return timeout_ms < 0 ? Clock::time_point::max() : now + std::chrono::milliseconds{timeout_ms};
+}
+
+auto resultValue(const Result<int> &result) -> std::int64_t
+{
+    return result ? *result : result.error().code;
+}
+
+auto isWriteSide(int op) -> bool
+{
+    return op == toInt(QueueOp::kWrite) || op == toInt(QueueOp::kDrain);
+}
+
+// 0 if @p entry can run, otherwise the status it completes with right away.
+auto checkSubmission(const QueueSubmission &entry) -> StatusCodeValue
+{
+    if (entry.op < toInt(QueueOp::kRead) || entry.op > toInt(QueueOp::kReadUntilSequence))
+    {
+        return StatusCode::Io::kBufferError;
+    }
+    if (entry.op == toInt(QueueOp::kDrain))
+    {
+        return StatusCode::kSuccess;
+    }
+    if (entry.buffer == nullptr || entry.buffer_size <= 0)
+    {
+        return StatusCode::Io::kBufferError;
+    }
+    if ((entry.op == toInt(QueueOp::kReadUntil) || entry.op == toInt(QueueOp::kReadUntilSequence))
+        && entry.sequence == nullptr)
+    {
+        return StatusCode::Io::kBufferError;
+    }
+    if (entry.op == toInt(QueueOp::kReadUntilSequence) && entry.sequence_size <= 0)
+    {
+        return StatusCode::Io::kBufferError;
+    }
+    return StatusCode::kSuccess;
+}
+
+} // namespace
+
+auto PortPath::parse(std::string_view path) -> std::optional<PortPath>
+{
+    if (path.starts_with(kReplayScheme))
+    {
+        PortPath parsed;
+        auto file = path.substr(kReplayScheme.size());
+        if (file.ends_with(kUnpacedSuffix))
+        {
+            parsed.paced = false;
+            file.remove_suffix(kUnpacedSuffix.size());
+        }
+        else if (const auto query = file.rfind(kSpeedQuery); query != std::string_view::npos)
+        {
+            const auto value = file.substr(query + kSpeedQuery.size());
+            const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), parsed.speed);
+            if (error != std::errc{} || end != value.data() + value.size() || !(parsed.speed > 0.0))
+            {
+                return std::nullopt;
+            }
+            file = file.substr(0, query);
+        }
+        if (file.empty())
+        {
+            return std::nullopt;
+        }
+        parsed.replay = std::string(file);
+        parsed.device = std::string(kReplayScheme) + parsed.replay;
+        return parsed;
+    }
+    if (!path.starts_with(kScheme))
+    {
+        return std::nullopt;
+    }
+    path.remove_prefix(kScheme.size());
+    PortPath parsed;
+    if (path.ends_with(kUnpacedSuffix))
+    {
+        parsed.paced = false;
+        path.remove_suffix(kUnpacedSuffix.size());
+    }
+    if (const auto slash = path.find('/'); slash != std::string_view::npos)
+    {
+        const auto end = path.substr(slash + 1);
+        if (end != "0" && end != "1")
+        {
+            return std::nullopt;
+        }
+        parsed.end = end == "0" ? 0 : 1;
+        path = path.substr(0, slash);
+    }
+    if (path.empty())
+    {
+        return std::nullopt;
+    }
+    parsed.device = std::string(path);
+    return parsed;
+}
+
+auto PortPath::name() const -> std::string
+{
+    if (!replay.empty())
+    {
+        return device;
+    }
+    auto result = std::string(kScheme) + device;
+    if (end >= 0)
+    {
+        result += end == 0 ? "/0" : "/1";
+    }
+    return result;
+}
+
+auto characterTime(const SerialConfig &config) -> Clock::duration
+{
+    const std::int64_t bits = 1 + config.data_bits + (config.parity == Parity::kNone ? 0 : 1)
+                            + (config.stop_bits == StopBits::kTwo ? 2 : 1);
+    return std::chrono::duration_cast<Clock::duration>(
+        std::chrono::nanoseconds{bits * 1'000'000'000 / config.baudrate});
+}
+
+auto MappedFile::tryMap(const std::string &path) -> Result<MappedFile>
+{
+    const int descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (descriptor < 0)
+    {
+        return fail<MappedFile>(StatusCode::Connection::kNotFoundError, "Cannot open capture file");
+    }
+    const ScopeGuard closer([descriptor] { ::close(descriptor); });
+    struct stat info{};
+    if (::fstat(descriptor, &info) != 0 || info.st_size <= 0)
+    {
+        return fail<MappedFile>(StatusCode::Connection::kNotFoundError, "Not a capture file");
+    }
+    const auto size = static_cast<std::size_t>(info.st_size);
+    void *data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    if (data == MAP_FAILED)
+    {
+        return fail<MappedFile>(StatusCode::Connection::kNotFoundError, "Cannot map capture file");
+    }
+    // Replays read front to back: aggressive read-ahead, and pages behind the replay can go early.
+    (void)::madvise(data, size, MADV_SEQUENTIAL);
+    return MappedFile({static_cast<const std::byte *>(data), size});
+}
+
+MappedFile::MappedFile(MappedFile &&other) noexcept : bytes_(std::exchange(other.bytes_, {}))
+{
+}
+
+MappedFile::~MappedFile()
+{
+    if (!bytes_.empty())
+    {
+        ::munmap(const_cast<std::byte *>(bytes_.data()), bytes_.size());
+    }
+}
+
+auto Replay::tryOpen(const PortPath &path, Clock::time_point now) -> Result<std::unique_ptr<Replay>>
+{
+    auto mapped = MappedFile::tryMap(path.replay);
+    if (!mapped)
+    {
+        return forwardUnexpected(std::move(mapped));
+    }
+    auto reader = capture::Reader::tryMake(mapped->bytes());
+    if (!reader)
+    {
+        return fail<std::unique_ptr<Replay>>(StatusCode::Connection::kNotFoundError, "Not a capture file");
+    }
+    auto replay = std::unique_ptr<Replay>(new Replay{
+        .file = std::move(*mapped),
+        .reader = *reader,
+        .pending = std::nullopt,
+        .offset = 0,
+        .origin = now,
+        .first_ns = 0,
+        .speed = path.speed,
+        .paced = path.paced,
+        .lines = 0,
+    });
+    replay->pending = replay->reader.next();
+    replay->first_ns = replay->pending ? replay->pending->timestamp_ns : 0;
+    return replay;
+}
+
+// Replay time 0 is the capture's first record, at open.
+auto Replay::dueAt(const capture::Record &record) const -> Clock::time_point
+{
+    if (!paced)
+    {
+        return Clock::time_point::min();
+    }
+    const auto since_first = std::chrono::duration<double, std::nano>(
+        static_cast<double>(record.timestamp_ns - first_ns) / speed);
+    return origin + std::chrono::duration_cast<Clock::duration>(since_first);
+}
+
+auto PoolTraits::close(handle_type handle) noexcept -> void
+{
+    (void)Loopback::instance().closeNow(handle);
+}
+
+auto Loopback::instance() -> Loopback &
+{
+    static auto *const loopback = new Loopback();
+    return *loopback;
+}
+
+// Lookup and pinning ---------------------------------------------------------
+
+auto Loopback::find(std::int64_t handle) -> Result<Endpoint *>
+{
+    const auto found = handles_.find(handle);
+    if (found == handles_.end())
+    {
+        return fail<Endpoint *>(StatusCode::Connection::kInvalidHandleError, "Invalid handle");
+    }
+    return found->second;
+}
+
+template <typename Body> auto Loopback::withEndpoint(std::int64_t handle, Body &&body)
+{
+    using Out = std::invoke_result_t<Body, Lock &, Endpoint &>;
+    Lock lock(mutex_);
+    auto found = find(handle);
+    if (!found)
+    {
+        return Out{forwardUnexpected(std::move(found))};
+    }
+    auto &endpoint = **found;
+    ++endpoint.users;
+    const auto left = onScopeExit([&] { leave(endpoint); });
+    return std::invoke(std::forward<Body>(body), lock, endpoint);
+}
+
+auto Loopback::leave(Endpoint &endpoint) -> void
+{
+    if (--endpoint.users == 0)
+    {
+        changed_.notify_all();
+    }
+}
+
+auto Loopback::waitUntil(Lock &lock, Clock::time_point until) -> void
+{
+    if (until == Clock::time_point::max())
+    {
+        changed_.wait(lock);
+    }
+    else
+    {
+        changed_.wait_until(lock, until);
+    }
+}
+
+auto Loopback::aggregateLatency() noexcept -> LatencyHistograms *
+{
+    return latency_enabled_.load(std::memory_order_relaxed) ? &latency_all_ : nullptr;
+}
+
+// Wire model -----------------------------------------------------------------
+
+// RTS as the peer sees it: asserted by the host, and dropped automatically while an RTS/CTS receiver is full.
+auto Loopback::lineRts(const Endpoint &endpoint) -> bool
+{
+    return endpoint.handle != 0 && endpoint.rts
+        && !(endpoint.config.flow_control == FlowControl::kRtsCts && endpoint.rx.full());
+}
+
+// Modem lines as @p endpoint sees them, as capture::LineBit flags.
+auto Loopback::lineState(const Endpoint &endpoint) -> std::uint8_t
+{
+    if (endpoint.replay)
+    {
+        const auto inputs = capture::lineMask(false, false, true, true, true, true);
+        return static_cast<std::uint8_t>((endpoint.replay->lines & inputs)
+                                         | capture::lineMask(endpoint.dtr, endpoint.rts, false, false, false, false));
+    }
+    const bool dsr = endpoint.peer->handle != 0 && endpoint.peer->dtr;
+    // Null-modem wiring: DTR feeds both DSR and DCD on the other side.
+    return capture::lineMask(endpoint.dtr, endpoint.rts, lineRts(*endpoint.peer), dsr, dsr, false);
+}
+
+auto Loopback::captureLines(Endpoint &endpoint, Clock::time_point now) -> void
+{
+    if (endpoint.capture)
+    {
+        endpoint.capture->lines(lineState(endpoint), now);
+    }
+    auto &peer = *endpoint.peer;
+    if (&peer != &endpoint && peer.capture)
+    {
+        peer.capture->lines(lineState(peer), now);
+    }
+}
+
+auto Loopback::nextArrival(const Endpoint &receiver) -> Clock::time_point
+{
+    if (receiver.replay)
+    {
+        return nextReplayed(receiver);
+    }
+    const auto &sender = *receiver.peer;
+    const auto &line = sender.tx;
+    if (line.bytes.empty() || (receiver.handle != 0 && receiver.acquired && receiver.read_callback == nullptr))
+    {
+        return Clock::time_point::max();
+    }
+    if (sender.config.flow_control == FlowControl::kRtsCts && !lineRts(receiver))
+    {
+        return Clock::time_point::max();
+    }
+    return sender.paced ? line.head_start + characterTime(sender.config) : line.head_start;
+}
+
+// Move every byte that has finished shifting out of the peer's wire into @p receiver.
+auto Loopback::deliver(Endpoint &receiver, Clock::time_point now) -> void
+{
+    if (receiver.replay)
+    {
+        deliverReplayed(receiver, now);
+        return;
+    }
+    auto &sender = *receiver.peer;
+    auto &line = sender.tx;
+    if (line.bytes.empty())
+    {
+        return;
+    }
+    if (sender.config.flow_control == FlowControl::kRtsCts && !lineRts(receiver))
+    {
+        // CTS low: the sender holds the next character, the wire stays idle.
+        line.head_start = std::max(line.head_start, now);
+        return;
+    }
+    const auto char_time = sender.paced ? characterTime(sender.config) : Clock::duration::zero();
+    auto arrived = line.bytes.size();
+    if (char_time != Clock::duration::zero())
+    {
+        if (now < line.head_start + char_time)
+        {
+            return;
+        }
+        arrived = std::min(arrived, static_cast<std::size_t>((now - line.head_start) / char_time));
+    }
+
+    auto taken = arrived;
+    std::size_t received = 0;
+    if (receiver.handle == 0 || receiver.closing)
+    {
+        // Nobody listening: the bytes fall off the end of the cable.
+    }
+    else if (receiver.read_callback != nullptr)
+    {
+        receiver.callback_bytes.insert(receiver.callback_bytes.end(), line.bytes.begin(),
+                                       line.bytes.begin() + static_cast<std::ptrdiff_t>(arrived));
+        received = arrived;
+    }
+    else if (receiver.acquired)
+    {
+        // Compacting the ring would move acquired bytes; they wait in the FIFO until serialRxRelease().
+        taken = 0;
+    }
+    else
+    {
+        taken = 0;
+        while (taken < arrived)
+        {
+            const auto space = receiver.rx.writable();
+            if (space.empty())
+            {
+                break;
+            }
+            const auto count = std::min(space.size(), arrived - taken);
+            std::copy_n(line.bytes.begin() + static_cast<std::ptrdiff_t>(taken), count, space.begin());
+            receiver.rx.commit(count);
+            taken += count;
+        }
+        received = taken;
+        const bool held = sender.config.flow_control == FlowControl::kRtsCts
+                       && receiver.config.flow_control == FlowControl::kRtsCts;
+        if (taken < arrived && !held)
+        {
+            receiver.overrun_errors += static_cast<std::int64_t>(arrived - taken);
+            taken = arrived;
+        }
+    }
+    if (receiver.capture && received != 0)
+    {
+        // Stamped when the last byte arrived, not when this call noticed.
+        const auto arrival = std::min(now, line.head_start + char_time * static_cast<Clock::rep>(received));
+        const std::vector<std::byte> bytes(line.bytes.begin(),
+                                           line.bytes.begin() + static_cast<std::ptrdiff_t>(received));
+        receiver.capture->data(capture::Direction::kRx, bytes, arrival);
+    }
+    if (taken == 0)
+    {
+        return;
+    }
+    line.bytes.erase(line.bytes.begin(), line.bytes.begin() + static_cast<std::ptrdiff_t>(taken));
+    line.head_start += char_time * static_cast<Clock::rep>(taken);
+    syncWaitFd(receiver);
+    changed_.notify_all();
+}
+
+auto Loopback::nextReplayed(const Endpoint &receiver) -> Clock::time_point
+{
+    const auto &replay = *receiver.replay;
+    if (!replay.pending)
+    {
+        return Clock::time_point::max();
+    }
+    const bool data = replay.pending->kind == capture::RecordKind::kData
+                   && replay.pending->direction == capture::Direction::kRx;
+    if (data && receiver.read_callback == nullptr && (receiver.acquired || receiver.rx.full()))
+    {
+        return Clock::time_point::max();
+    }
+    return replay.dueAt(*replay.pending);
+}
+
+// Replay every capture record that is due into @p receiver. Received bytes the ring has no room for stay in the
+// file until it does, so a slow reader sees the capture late but complete.
+auto Loopback::deliverReplayed(Endpoint &receiver, Clock::time_point now) -> void
+{
+    auto &replay = *receiver.replay;
+    bool changed = false;
+    while (replay.pending && replay.dueAt(*replay.pending) <= now)
+    {
+        const auto &record = *replay.pending;
+        if (record.kind == capture::RecordKind::kData && record.direction == capture::Direction::kRx)
+        {
+            const auto rest = record.payload.subspan(replay.offset);
+            std::size_t taken = 0;
+            if (receiver.read_callback != nullptr)
+            {
+                receiver.callback_bytes.insert(receiver.callback_bytes.end(), rest.begin(), rest.end());
+                taken = rest.size();
+            }
+            else if (!receiver.acquired)
+            {
+                while (taken < rest.size())
+                {
+                    const auto space = receiver.rx.writable();
+                    if (space.empty())
+                    {
+                        break;
+                    }
+                    const auto count = std::min(space.size(), rest.size() - taken);
+                    std::copy_n(rest.begin() + static_cast<std::ptrdiff_t>(taken), count, space.begin());
+                    receiver.rx.commit(count);
+                    taken += count;
+                }
+            }
+            if (receiver.capture && taken != 0)
+            {
+                receiver.capture->data(capture::Direction::kRx, rest.first(taken), now);
+            }
+            replay.offset += taken;
+            changed = changed || taken != 0;
+            if (replay.offset < record.payload.size())
+            {
+                break;
+            }
+        }
+        else if (record.kind == capture::RecordKind::kLines)
+        {
+            replay.lines = record.lines();
+            if (receiver.capture)
+            {
+                receiver.capture->lines(lineState(receiver), now);
+            }
+            changed = true;
+        }
+        else if (record.kind == capture::RecordKind::kBreak && record.direction == capture::Direction::kRx)
+        {
+            ++receiver.breaks;
+        }
+        // Sent data and configuration changes describe the recording host, not the device.
+        replay.pending = replay.reader.next();
+        replay.offset = 0;
+    }
+    if (changed)
+    {
+        syncWaitFd(receiver);
+        changed_.notify_all();
+    }
+}
+
+auto Loopback::enqueue(Endpoint &sender, std::span<const std::byte> data, Clock::time_point now) -> void
+{
+    auto &line = sender.tx;
+    if (line.bytes.empty())
+    {
+        line.head_start = std::max(now, line.idle_from);
+    }
+    line.bytes.insert(line.bytes.end(), data.begin(), data.end());
+    changed_.notify_all();
+}
+
+// Level-triggered: the eventfd counter is 1 exactly while the receive ring holds data.
+auto Loopback::syncWaitFd(Endpoint &endpoint) -> void
+{
+    const bool ready = !endpoint.rx.empty();
+    if (endpoint.wait_fd < 0 || ready == endpoint.wait_signaled)
+    {
+        return;
+    }
+    std::uint64_t value = 1;
+    [[maybe_unused]] const auto done = ready ? ::write(endpoint.wait_fd, &value, sizeof value)
+                                             : ::read(endpoint.wait_fd, &value, sizeof value);
+    endpoint.wait_signaled = ready;
+}
+
+auto Loopback::syncEventFd() -> void
+{
+    const bool ready = !events_.empty() || !completions_.empty();
+    if (event_fd_ < 0 || ready == event_signaled_)
+    {
+        return;
+    }
+    std::uint64_t value = 1;
+    [[maybe_unused]] const auto done =
+        ready ? ::write(event_fd_, &value, sizeof value) : ::read(event_fd_, &value, sizeof value);
+    event_signaled_ = ready;
+}
+
+// Open / close ---------------------------------------------------------------
+
+auto Loopback::open(std::string_view path, const SerialConfig &config) -> Result<std::int64_t>
+{
+    const auto started = Clock::now();
+    const LatencyTimer timer(LatencyOp::kOpen, nullptr, aggregateLatency());
+    const auto parsed = PortPath::parse(path);
+    if (!parsed)
+    {
+        return fail<std::int64_t>(StatusCode::Connection::kNotFoundError, "Not a loop:// or replay:// port");
+    }
+    auto checked = config.validated();
+    if (!checked)
+    {
+        return forwardUnexpected(std::move(checked));
+    }
+    if (auto parked = pool_.acquire(path, config))
+    {
+        const auto handle = parked.release();
+        unpark(handle, started);
+        return handle;
+    }
+    std::unique_ptr<Replay> replay;
+    if (!parsed->replay.empty())
+    {
+        auto opened = Replay::tryOpen(*parsed, Clock::now());
+        if (!opened)
+        {
+            return forwardUnexpected(std::move(opened));
+        }
+        replay = std::move(*opened);
+    }
+
+    PortEvents events;
+    Lock lock(mutex_);
+    Endpoint *endpoint = nullptr;
+    while (true)
+    {
+        auto device = devices_.find(parsed->device);
+        if (device == devices_.end())
+        {
+            auto created = std::make_unique<Device>();
+            const int ends = parsed->end < 0 ? 1 : 2;
+            for (int end = 0; end < ends; ++end)
+            {
+                auto name = *parsed;
+                name.end = ends == 1 ? -1 : end;
+                auto &added = created->ends.emplace_back(std::make_unique<Endpoint>());
+                added->device = parsed->device;
+                added->path = name.name();
+                events.emplace_back(1, added->path);
+            }
+            created->ends.front()->peer = created->ends.back().get();
+            created->ends.back()->peer = created->ends.front().get();
+            device = devices_.emplace(parsed->device, std::move(created)).first;
+        }
+        const auto &ends = device->second->ends;
+        if ((parsed->end < 0) != (ends.size() == 1))
+        {
+            return fail<std::int64_t>(StatusCode::Connection::kNotFoundError, "Wrong loop:// port kind");
+        }
+        endpoint = ends[parsed->end < 0 ? 0 : static_cast<std::size_t>(parsed->end)].get();
+        if (endpoint->closing)
+        {
+            // A concurrent serialClose() may still remove the device; look it up again afterwards.
+            changed_.wait(lock);
+            continue;
+        }
+        if (endpoint->handle == 0)
+        {
+            break;
+        }
+        // Parked under other line settings or another spelling of the path: close it and look again.
+        const auto holder = endpoint->opened_as;
+        lock.unlock();
+        const auto evicted = pool_.evict(holder);
+        lock.lock();
+        if (evicted == 0)
+        {
+            return fail<std::int64_t>(StatusCode::Connection::kNotFoundError, "Port is busy");
+        }
+    }
+
+    const auto now = Clock::now();
+    endpoint->handle = next_handle_++;
+    endpoint->opened_as = std::string(path);
+    endpoint->paced = parsed->paced;
+    endpoint->config = *checked;
+    endpoint->dtr = true;
+    endpoint->rts = true;
+    endpoint->rx.clear();
+    endpoint->acquired = false;
+    endpoint->acquisition_cleared = false;
+    endpoint->tx.bytes.clear();
+    endpoint->tx.head_start = now;
+    endpoint->tx.idle_from = now;
+    endpoint->stats.emplace();
+    endpoint->latency.reset();
+    if (latency_enabled_.load(std::memory_order_relaxed))
+    {
+        endpoint->latency = std::make_unique<LatencyHistograms>();
+        endpoint->latency->of(LatencyOp::kOpen).record(Clock::now() - started);
+    }
+    endpoint->overrun_errors = 0;
+    endpoint->breaks = 0;
+    if (replay)
+    {
+        replay->origin = now;
+        endpoint->replay = std::move(replay);
+    }
+    captureLines(*endpoint, now);
+    handles_.emplace(endpoint->handle, endpoint);
+    const auto handle = endpoint->handle;
+    changed_.notify_all();
+    lock.unlock();
+    emitPortEvents(events);
+    return handle;
+}
+
+auto Loopback::close(std::int64_t handle) -> Status
+{
+    const LatencyTimer timer(LatencyOp::kClose, nullptr, aggregateLatency());
+    if (!pool_.enabled())
+    {
+        return closeNow(handle);
+    }
+    std::string path;
+    SerialConfig config{};
+    {
+        const Lock lock(mutex_);
+        auto found = find(handle);
+        if (!found)
+        {
+            return forwardUnexpected(std::move(found));
+        }
+        path = (*found)->opened_as;
+        config = (*found)->config;
+    }
+    if (path.starts_with(kReplayScheme))
+    {
+        // Reopening a replay starts it over; a parked handle would resume mid-capture.
+        return closeNow(handle);
+    }
+    (void)pool_.park(std::move(path), config, HandlePool<PoolTraits>::Resource{handle},
+                     [this](std::int64_t parked) { return park(parked).has_value(); });
+    return ok();
+}
+
+auto Loopback::park(std::int64_t handle) -> Status
+{
+    Lock lock(mutex_);
+    auto found = find(handle);
+    if (!found)
+    {
+        return forwardUnexpected(std::move(found));
+    }
+    auto &endpoint = **found;
+    // A parked handle must not call back into a host that believes it closed the port.
+    ++endpoint.registration;
+    endpoint.read_callback = nullptr;
+    endpoint.read_user_data = nullptr;
+    endpoint.write_callback = nullptr;
+    endpoint.write_user_data = nullptr;
+    endpoint.callback_bytes.clear();
+    // Blocked calls and queued operations complete with abort codes, as on close.
+    ++endpoint.read_generation;
+    ++endpoint.write_generation;
+    changed_.notify_all();
+    changed_.wait(lock, [&] {
+        return endpoint.users == 0 && endpoint.callbacks_running == 0
+            && std::ranges::none_of(endpoint.workers, &Worker::running);
+    });
+
+    const auto now = Clock::now();
+    deliver(endpoint, now);
+    endpoint.rx.clear();
+    endpoint.acquired = false;
+    endpoint.acquisition_cleared = false;
+    endpoint.dtr = false;
+    endpoint.rts = false;
+    captureLines(endpoint, now);
+    // The capture ends with the lines dropping, as it does on close.
+    endpoint.capture.reset();
+    endpoint.stats.emplace();
+    endpoint.latency.reset();
+    endpoint.overrun_errors = 0;
+    endpoint.breaks = 0;
+    if (endpoint.wait_fd >= 0)
+    {
+        ::close(endpoint.wait_fd);
+        endpoint.wait_fd = -1;
+        endpoint.wait_signaled = false;
+    }
+    unwatch(endpoint);
+    changed_.notify_all();
+    return ok();
+}
+
+auto Loopback::unpark(std::int64_t handle, Clock::time_point started) -> void
+{
+    const Lock lock(mutex_);
+    auto found = find(handle);
+    if (!found)
+    {
+        return;
+    }
+    auto &endpoint = **found;
+    endpoint.dtr = true;
+    endpoint.rts = true;
+    captureLines(endpoint, Clock::now());
+    if (latency_enabled_.load(std::memory_order_relaxed))
+    {
+        endpoint.latency = std::make_unique<LatencyHistograms>();
+        endpoint.latency->of(LatencyOp::kOpen).record(Clock::now() - started);
+    }
+    changed_.notify_all();
+}
+
+auto Loopback::closeNow(std::int64_t handle) -> Status
+{
+    Lock lock(mutex_);
+    auto found = find(handle);
+    if (!found)
+    {
+        return forwardUnexpected(std::move(found));
+    }
+    auto &endpoint = **found;
+    handles_.erase(handle);
+    endpoint.handle = 0;
+    endpoint.closing = true;
+    ++endpoint.read_generation;
+    ++endpoint.write_generation;
+    changed_.notify_all();
+    changed_.wait(lock, [&] { return endpoint.users == 0 && endpoint.callbacks_running == 0; });
+
+    // Queued operations complete with abort codes; the workers exit once their queues are empty.
+    std::array<std::thread, 2> workers;
+    for (std::size_t direction = 0; direction < workers.size(); ++direction)
+    {
+        workers[direction] = std::move(endpoint.workers[direction].thread);
+    }
+    lock.unlock();
+    for (auto &worker : workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+    lock.lock();
+
+    endpoint.rx.clear();
+    endpoint.acquired = false;
+    endpoint.acquisition_cleared = false;
+    endpoint.tx.bytes.clear();
+    endpoint.dtr = false;
+    endpoint.rts = false;
+    endpoint.read_callback = nullptr;
+    endpoint.read_user_data = nullptr;
+    endpoint.write_callback = nullptr;
+    endpoint.write_user_data = nullptr;
+    endpoint.callback_bytes.clear();
+    ++endpoint.registration;
+    endpoint.latency.reset();
+    endpoint.capture.reset();
+    endpoint.replay.reset();
+    captureLines(endpoint, Clock::now());
+    if (endpoint.wait_fd >= 0)
+    {
+        ::close(endpoint.wait_fd);
+        endpoint.wait_fd = -1;
+        endpoint.wait_signaled = false;
+    }
+    unwatch(endpoint);
+    endpoint.closing = false;
+
+    PortEvents events;
+    const auto device = devices_.find(endpoint.device);
+    const auto &ends = device->second->ends;
+    if (std::ranges::all_of(ends, [](const auto &end) { return end->handle == 0 && !end->closing; }))
+    {
+        for (const auto &end : ends)
+        {
+            events.emplace_back(0, end->path);
+        }
+        devices_.erase(device);
+    }
+    changed_.notify_all();
+    lock.unlock();
+    emitPortEvents(events);
+    return ok();
+}
+
+// Data path ------------------------------------------------------------------
+
+auto Loopback::readLocked(Lock &lock, Endpoint &endpoint, std::uint64_t generation, std::span<std::byte> out,
+                          std::span<const std::byte> terminator, Timing timing) -> Result<int>
+{
+    auto now = Clock::now();
+    auto deadline = deadlineAfter(now, timing.first);
+    std::size_t filled = 0;
+    while (true)
+    {
+        if (endpoint.handle == 0 || endpoint.read_generation != generation)
+        {
+            return fail<int>(StatusCode::Io::kAbortReadError, "Read aborted");
+        }
+        if (endpoint.acquired)
+        {
+            return fail<int>(StatusCode::Io::kBufferError, "Ring is acquired");
+        }
+        deliver(endpoint, now);
+        const auto copied = endpoint.rx.peek(out.subspan(filled));
+        auto taken = copied;
+        bool found = false;
+        if (!terminator.empty() && copied != 0)
+        {
+            // Only the new bytes plus the tail a terminator could straddle need searching.
+            const auto from = filled - std::min(filled, terminator.size() - 1);
+            const auto window = std::span<const std::byte>(out).subspan(from, filled + copied - from);
+            if (const auto at = findSequence(window, terminator); at != kNotFound)
+            {
+                // Surplus after the terminator stays in the ring for the next read.
+                taken = from + at + terminator.size() - filled;
+                found = true;
+            }
+        }
+        if (taken != 0)
+        {
+            endpoint.rx.discard(taken);
+            filled += taken;
+            syncWaitFd(endpoint);
+            changed_.notify_all();
+            if (!timing.total)
+            {
+                deadline = deadlineAfter(now, timing.next);
+            }
+        }
+        if (found || filled == out.size() || now >= deadline)
+        {
+            return static_cast<int>(filled);
+        }
+        waitUntil(lock, std::min(deadline, nextArrival(endpoint)));
+        now = Clock::now();
+    }
+}
+
+auto Loopback::writeLocked(Lock &lock, Endpoint &endpoint, std::uint64_t generation, std::span<const std::byte> data,
+                           Timing timing) -> Result<int>
+{
+    auto &receiver = *endpoint.peer;
+    auto now = Clock::now();
+    auto deadline = deadlineAfter(now, timing.first);
+    std::size_t accepted = 0;
+    while (true)
+    {
+        if (endpoint.handle == 0 || endpoint.write_generation != generation)
+        {
+            return fail<int>(StatusCode::Io::kAbortWriteError, "Write aborted");
+        }
+        if (endpoint.replay)
+        {
+            // A replay has no far end: writes are accepted and dropped.
+            return static_cast<int>(data.size());
+        }
+        deliver(receiver, now);
+        const auto count = std::min(kTxCapacity - std::min(kTxCapacity, endpoint.tx.bytes.size()),
+                                    data.size() - accepted);
+        if (count != 0)
+        {
+            if (endpoint.capture)
+            {
+                endpoint.capture->data(capture::Direction::kTx, data.subspan(accepted, count), now);
+            }
+            enqueue(endpoint, data.subspan(accepted, count), now);
+            accepted += count;
+            if (!timing.total)
+            {
+                deadline = deadlineAfter(now, timing.next);
+            }
+        }
+        if (accepted == data.size() || now >= deadline)
+        {
+            return static_cast<int>(accepted);
+        }
+        waitUntil(lock, std::min(deadline, nextArrival(receiver)));
+        now = Clock::now();
+    }
+}
+
+auto Loopback::drainLocked(Lock &lock, Endpoint &endpoint, std::uint64_t generation) -> Status
+{
+    auto &receiver = *endpoint.peer;
+    while (true)
+    {
+        if (endpoint.handle == 0 || endpoint.write_generation != generation)
+        {
+            return fail(StatusCode::Io::kAbortWriteError, "Drain aborted");
+        }
+        deliver(receiver, Clock::now());
+        if (endpoint.tx.bytes.empty())
+        {
+            return ok();
+        }
+        waitUntil(lock, nextArrival(receiver));
+    }
+}
+
+auto Loopback::read(std::int64_t handle, std::span<std::byte> out, std::span<const std::byte> terminator,
+                    Timing timing) -> Result<int>
+{
+    return withEndpoint(handle, [&](Lock &lock, Endpoint &endpoint) {
+        const LatencyTimer timer(terminator.empty() ? LatencyOp::kRead : LatencyOp::kReadUntil, endpoint.latency.get(),
+                                 aggregateLatency());
+        auto result = readLocked(lock, endpoint, endpoint.read_generation, out, terminator, timing);
+        endpoint.stats->recordRead(resultValue(result));
+        return result;
+    });
+}
+
+auto Loopback::readV(std::int64_t handle, std::span<const IoVec> buffers, Timing timing) -> Result<int>
+{
+    thread_local std::vector<std::byte> staging;
+    std::size_t total = 0;
+    for (const auto &buffer : buffers)
+    {
+        total += static_cast<std::size_t>(buffer.size);
+    }
+    staging.resize(total);
+    auto result = read(handle, staging, {}, timing);
+    if (!result)
+    {
+        return result;
+    }
+    std::size_t offset = 0;
+    for (const auto &buffer : buffers)
+    {
+        const auto count = std::min(static_cast<std::size_t>(buffer.size), static_cast<std::size_t>(*result) - offset);
+        if (count == 0)
+        {
+            continue;
+        }
+        std::memcpy(buffer.data, staging.data() + offset, count);
+        offset += count;
+    }
+    return result;
+}
+
+auto Loopback::peek(std::int64_t handle, std::span<std::byte> out, int timeout_ms) -> Result<int>
+{
+    return withEndpoint(handle, [&](Lock &lock, Endpoint &endpoint) -> Result<int> {
+        const auto generation = endpoint.read_generation;
+        auto now = Clock::now();
+        const auto deadline = deadlineAfter(now, timeout_ms);
+        while (true)
+        {
+            if (endpoint.handle == 0 || endpoint.read_generation != generation)
+            {
+                endpoint.stats->recordRead(StatusCode::Io::kAbortReadError);
+                return fail<int>(StatusCode::Io::kAbortReadError, "Peek aborted");
+            }
+            deliver(endpoint, now);
+            if (!endpoint.rx.empty() || now >= deadline)
+            {
+                break;
+            }
+            waitUntil(lock, std::min(deadline, nextArrival(endpoint)));
+            now = Clock::now();
+        }
+        const auto copied = static_cast<int>(endpoint.rx.peek(out));
+        // Peeked bytes are counted once, by the read that consumes them.
+        if (copied == 0)
+        {
+            endpoint.stats->recordRead(0);
+        }
+        return copied;
+    });
+}
+
+auto Loopback::write(std::int64_t handle, std::span<const std::byte> data, Timing timing) -> Result<int>
+{
+    return withEndpoint(handle, [&](Lock &lock, Endpoint &endpoint) {
+        Result<int> result = 0;
+        {
+            // The write callback below is the host's time, not the call's.
+            const LatencyTimer timer(LatencyOp::kWrite, endpoint.latency.get(), aggregateLatency());
+            result = writeLocked(lock, endpoint, endpoint.write_generation, data, timing);
+        }
+        endpoint.stats->recordWrite(resultValue(result));
+        if (result && *result > 0 && endpoint.write_callback != nullptr)
+        {
+            handOver(lock, endpoint, endpoint.write_callback, endpoint.write_user_data,
+                     data.first(static_cast<std::size_t>(*result)));
+        }
+        return result;
+    });
+}
+
+auto Loopback::writeV(std::int64_t handle, std::span<const IoVec> buffers, Timing timing) -> Result<int>
+{
+    thread_local std::vector<std::byte> staging;
+    staging.clear();
+    for (const auto &buffer : buffers)
+    {
+        const auto *bytes = static_cast<const std::byte *>(buffer.data);
+        staging.insert(staging.end(), bytes, bytes + buffer.size);
+    }
+    return write(handle, staging, timing);
+}
+
+auto Loopback::drain(std::int64_t handle) -> Status
+{
+    return withEndpoint(handle, [&](Lock &lock, Endpoint &endpoint) {
+        const LatencyTimer timer(LatencyOp::kDrain, endpoint.latency.get(), aggregateLatency());
+        return drainLocked(lock, endpoint, endpoint.write_generation);
+    });
+}
+
+auto Loopback::clearBufferIn(std::int64_t handle) -> Status
+{
+    return withEndpoint(handle, [&](Lock &, Endpoint &endpoint) -> Status {
+        deliver(endpoint, Clock::now());
+        endpoint.rx.clear();
+        if (endpoint.acquired)
+        {
+            endpoint.acquired = false;
+            endpoint.acquisition_cleared = true;
+        }
+        syncWaitFd(endpoint);
+        changed_.notify_all();
+        return ok();
+    });
+}
+
+auto Loopback::clearBufferOut(std::int64_t handle) -> Status
+{
+    // Documented as drain-then-discard; after the drain nothing is left to discard.
+    return drain(handle);
+}
+
+auto Loopback::abortRead(std::int64_t handle) -> Status
+{
+    return withEndpoint(handle, [&](Lock &, Endpoint &endpoint) -> Status {
+        ++endpoint.read_generation;
+        changed_.notify_all();
+        return ok();
+    });
+}
+
+auto Loopback::abortWrite(std::int64_t handle) -> Status
+{
+    return withEndpoint(handle, [&](Lock &, Endpoint &endpoint) -> Status {
+        ++endpoint.write_generation;
+        changed_.notify_all();
+        return ok();
+    });
+}
+
+// Counters and configuration -------------------------------------------------
+
+auto Loopback::inBytesWaiting(std::int64_t handle) -> Result<int>
+{
+    return withEndpoint(handle, [&](Lock &, Endpoint &endpoint) -> Result<int> {
+        deliver(endpoint, Clock::now());
+        return static_cast<int>(endpoint.rx.size());
+    });
+}
+
+auto Loopback::outBytesWaiting(std::int64_t handle) -> Result<int>
+{
+    return withEndpoint(handle, [&](Lock &, Endpoint &endpoint) -> Result<int> {
+        deliver(*endpoint.peer, Clock::now());
+        return static_cast<int>(endpoint.tx.bytes.size());
+    });
+}
+
+auto Loopback::inBytesTotal(std::int64_t handle) -> Result<std::int64_t>
+{
+    return withEndpoint(handle, [&](Lock &, Endpoint &endpoint) -> Result<std::int64_t> {
+        return endpoint.stats->inBytesTotal();
+    });
+}
+
+auto Loopback::outBytesTotal(std::int64_t handle) -> Result<std::int64_t>
+{
+    return withEndpoint(handle, [&](Lock &, Endpoint &endpoint) -> Result<std::int64_t> {
+        return endpoint.stats->outBytesTotal();
+    });
+}
+
+auto Loopback::stats(std::int64_t handle, SerialStats &out) -> Status
+{
+    return withEndpoint(handle, [&](Lock &, Endpoint &endpoint) -> Status {
+        const auto now = Clock::now();
+        deliver(endpoint, now);
+        deliver(*endpoint.peer, now);
+        endpoint.stats->snapshot(out);
+        out.in_bytes_waiting = static_cast<std::int64_t>(endpoint.rx.size());
+        out.out_bytes_waiting = static_cast<std::int64_t>(endpoint.tx.bytes.size());
+        out.overrun_errors = endpoint.overrun_errors;
+        out.framing_errors = 0;
+        out.parity_errors = 0;
+        out.breaks = endpoint.breaks;
+        return ok();
+    });
+}
+
+auto Loopback::latencyHistogram(std::int64_t handle, LatencyOp op, std::span<LatencyBucket> out) -> Result<int>
+{
+    if (handle == 0)
+    {
+        return static_cast<int>(latency_all_.of(op).snapshot(out));
+    }
+    return withEndpoint(handle, [&](Lock &, Endpoint &endpoint) -> Result<int> {
+        if (!endpoint.latency)
+        {
+            return 0;
+        }
+        return static_cast<int>(endpoint.latency->of(op).snapshot(out));
+    });
+}
+
+auto Loopback::setLatencyHistograms(bool enabled) -> Status
+{
+    latency_enabled_.store(enabled, std::memory_order_relaxed);
+    return ok();
+}
+
+auto Loopback::captureStart(std::int64_t handle, const char *path) -> Status
+{
+    return withEndpoint(handle, [&](Lock &, Endpoint &endpoint) -> Status {
+        auto recorder = capture::Recorder::tryOpen(path);
+        if (!recorder)
+        {
+            return forwardUnexpected(std::move(recorder));
+        }
+        const auto now = Clock::now();
+        deliver(endpoint, now);
+        if (endpoint.capture)
+        {
+            // Starting a new capture ends the previous one.
+            (void)endpoint.capture->close();
+        }
+        endpoint.capture = std::move(*recorder);
+        endpoint.capture->config(endpoint.config, now);
+        endpoint.capture->lines(lineState(endpoint), now);
+        return ok();
+    });
+}
+
+auto Loopback::captureStop(std::int64_t handle) -> Status
+{
+    return withEndpoint(handle, [&](Lock &, Endpoint &endpoint) -> Status {
+        if (!endpoint.capture)
+        {
+            return ok();
+        }
+        // Bytes that have arrived by now belong in the capture even if nobody read them yet.
+        deliver(endpoint, Clock::now());
+        auto closed = endpoint.capture->close();
+        endpoint.capture.reset();
+        return closed;
+    });
+}
+
+auto Loopback::config(std::int64_t handle) -> Result<SerialConfig>
+{
+    return withEndpoint(handle, [&](Lock &, Endpoint &endpoint) -> Result<SerialConfig> { return endpoint.config; });
+}
+
+auto Loopback::configure(std::int64_t handle, const SerialConfig &wanted) -> Status
+{
+    return withEndpoint(handle, [&](Lock &, Endpoint &endpoint) {
+        // Bytes already on the wire arrive at the old rate.
+        const auto now = Clock::now();
+        deliver(endpoint, now);
+        deliver(*endpoint.peer, now);
+        auto applied = applyConfig(endpoint.config, wanted, [](const SerialConfig &, int) { return ok(); });
+        if (applied && endpoint.capture)
+        {
+            endpoint.capture->config(endpoint.config, now);
+        }
+        changed_.notify_all();
+        return applied;
+    });
+}
+
+// Modem lines ----------------------------------------------------------------
+
+auto Loopback::setLine(std::int64_t handle, bool Endpoint::*line, bool state) -> Status
+{
+    return withEndpoint(handle, [&](Lock &, Endpoint &endpoint) -> Status {
+        const auto now = Clock::now();
+        deliver(endpoint, now);
+        deliver(*endpoint.peer, now);
+        endpoint.*line = state;
+        captureLines(endpoint, now);
+        changed_.notify_all();
+        return ok();
+    });
+}
+
+auto Loopback::modemLine(std::int64_t handle, capture::LineBit line) -> Result<bool>
+{
+    return withEndpoint(handle, [&](Lock &, Endpoint &endpoint) -> Result<bool> {
+        if (endpoint.replay)
+        {
+            deliver(endpoint, Clock::now());
+        }
+        return capture::hasLine(lineState(endpoint), line);
+    });
+}
+
+auto Loopback::setDtr(std::int64_t handle, bool state) -> Status
+{
+    return setLine(handle, &Endpoint::dtr, state);
+}
+
+auto Loopback::setRts(std::int64_t handle, bool state) -> Status
+{
+    return setLine(handle, &Endpoint::rts, state);
+}
+
+auto Loopback::cts(std::int64_t handle) -> Result<bool>
+{
+    return modemLine(handle, capture::LineBit::kCts);
+}
+
+auto Loopback::dsr(std::int64_t handle) -> Result<bool>
+{
+    return modemLine(handle, capture::LineBit::kDsr);
+}
+
+auto Loopback::dcd(std::int64_t handle) -> Result<bool>
+{
+    return modemLine(handle, capture::LineBit::kDcd);
+}
+
+auto Loopback::ri(std::int64_t handle) -> Result<bool>
+{
+    return modemLine(handle, capture::LineBit::kRi);
+}
+
+auto Loopback::sendBreak(std::int64_t handle, int duration_ms) -> Status
+{
+    return withEndpoint(handle, [&](Lock &lock, Endpoint &endpoint) -> Status {
+        // The break follows the bytes already queued and keeps the wire busy for its duration.
+        auto drained = drainLocked(lock, endpoint, endpoint.write_generation);
+        if (!drained)
+        {
+            return drained;
+        }
+        const auto now = Clock::now();
+        const auto until = now + std::chrono::milliseconds{duration_ms};
+        endpoint.tx.idle_from = until;
+        if (endpoint.capture)
+        {
+            endpoint.capture->lineBreak(capture::Direction::kTx, duration_ms, now);
+        }
+        if (endpoint.peer->handle != 0)
+        {
+            ++endpoint.peer->breaks;
+            if (endpoint.peer->capture)
+            {
+                endpoint.peer->capture->lineBreak(capture::Direction::kRx, duration_ms, now);
+            }
+        }
+        lock.unlock();
+        std::this_thread::sleep_until(until);
+        lock.lock();
+        return ok();
+    });
+}
+
+// Readiness ------------------------------------------------------------------
+
+auto Loopback::waitHandle(std::int64_t handle) -> Result<std::int64_t>
+{
+    return withEndpoint(handle, [&](Lock &, Endpoint &endpoint) -> Result<std::int64_t> {
+        if (endpoint.wait_fd < 0)
+        {
+            const int descriptor = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+            if (descriptor < 0)
+            {
+                return fail<std::int64_t>(StatusCode::Io::kReadError, "eventfd failed");
+            }
+            endpoint.wait_fd = descriptor;
+            watch(endpoint);
+            deliver(endpoint, Clock::now());
+            syncWaitFd(endpoint);
+        }
+        return endpoint.wait_fd;
+    });
+}
+
+auto Loopback::pollLocked(Lock &lock, std::span<PollEntry> entries, int timeout_ms) -> int
+{
+    auto now = Clock::now();
+    const auto deadline = deadlineAfter(now, timeout_ms);
+    std::optional<std::uint64_t> generations_before;
+    while (true)
+    {
+        int ready = 0;
+        std::uint64_t generations = 0;
+        auto wake = deadline;
+        for (auto &entry : entries)
+        {
+            entry.revents = 0;
+            if (entry.handle <= 0)
+            {
+                continue;
+            }
+            const auto found = handles_.find(entry.handle);
+            if (found == handles_.end())
+            {
+                entry.revents = toInt(PollEvent::kInvalid);
+                ++ready;
+                continue;
+            }
+            auto &endpoint = *found->second;
+            deliver(endpoint, now);
+            deliver(*endpoint.peer, now);
+            generations += endpoint.read_generation;
+            if ((entry.events & toInt(PollEvent::kReadable)) != 0 && !endpoint.rx.empty() && !endpoint.acquired)
+            {
+                entry.revents |= toInt(PollEvent::kReadable);
+            }
+            if ((entry.events & toInt(PollEvent::kWritable)) != 0 && endpoint.tx.bytes.size() < kTxCapacity)
+            {
+                entry.revents |= toInt(PollEvent::kWritable);
+            }
+            ready += entry.revents != 0 ? 1 : 0;
+            wake = std::min({wake, nextArrival(endpoint), nextArrival(*endpoint.peer)});
+        }
+        // serialAbortRead() on any polled handle ends the wait.
+        if (ready != 0 || now >= deadline || (generations_before && *generations_before != generations))
+        {
+            return ready;
+        }
+        generations_before = generations;
+        waitUntil(lock, wake);
+        now = Clock::now();
+    }
+}
+
+auto Loopback::poll(std::span<PollEntry> entries, int timeout_ms) -> Result<int>
+{
+    Lock lock(mutex_);
+    return pollLocked(lock, entries, timeout_ms);
+}
+
+auto Loopback::readMany(std::span<ReadManyEntry> entries, int timeout_ms) -> Result<int>
+{
+    thread_local std::vector<PollEntry> polled;
+    thread_local std::vector<std::uint64_t> generations;
+    polled.clear();
+    generations.clear();
+    Lock lock(mutex_);
+    for (const auto &entry : entries)
+    {
+        const auto found = handles_.find(entry.handle);
+        polled.push_back(PollEntry{.handle = entry.handle, .events = toInt(PollEvent::kReadable), .revents = 0});
+        generations.push_back(found != handles_.end() ? found->second->read_generation : 0);
+    }
+    (void)pollLocked(lock, polled, timeout_ms);
+
+    int with_data = 0;
+    for (std::size_t i = 0; i < entries.size(); ++i)
+    {
+        auto &entry = entries[i];
+        entry.result = 0;
+        if (entry.handle <= 0)
+        {
+            continue;
+        }
+        auto found = find(entry.handle);
+        if (!found)
+        {
+            entry.result = static_cast<int>(found.error().code);
+            continue;
+        }
+        auto &endpoint = **found;
+        if (endpoint.read_generation != generations[i])
+        {
+            entry.result = static_cast<int>(StatusCode::Io::kAbortReadError);
+            endpoint.stats->recordRead(entry.result);
+            continue;
+        }
+        if ((polled[i].revents & toInt(PollEvent::kReadable)) == 0)
+        {
+            continue;
+        }
+        if (entry.buffer == nullptr || entry.buffer_size <= 0)
+        {
+            entry.result = static_cast<int>(StatusCode::Io::kBufferError);
+            continue;
+        }
+        // Timing::immediate() never waits, so the lock is held throughout and the endpoint needs no pin.
+        const auto out = std::span(static_cast<std::byte *>(entry.buffer), static_cast<std::size_t>(entry.buffer_size));
+        const auto result = readLocked(lock, endpoint, generations[i], out, {}, Timing::immediate());
+        entry.result = static_cast<int>(resultValue(result));
+        endpoint.stats->recordRead(entry.result);
+        with_data += entry.result > 0 ? 1 : 0;
+    }
+    return with_data;
+}
+
+auto Loopback::rxAcquire(std::int64_t handle, const void **data, int *size, int timeout_ms) -> Result<int>
+{
+    *data = nullptr;
+    *size = 0;
+    return withEndpoint(handle, [&](Lock &lock, Endpoint &endpoint) -> Result<int> {
+        const auto generation = endpoint.read_generation;
+        auto now = Clock::now();
+        const auto deadline = deadlineAfter(now, timeout_ms);
+        while (true)
+        {
+            if (endpoint.acquired)
+            {
+                return fail<int>(StatusCode::Io::kBufferError, "Already acquired");
+            }
+            if (endpoint.handle == 0 || endpoint.read_generation != generation)
+            {
+                endpoint.stats->recordRead(StatusCode::Io::kAbortReadError);
+                return fail<int>(StatusCode::Io::kAbortReadError, "Acquire aborted");
+            }
+            deliver(endpoint, now);
+            if (!endpoint.rx.empty())
+            {
+                break;
+            }
+            if (now >= deadline)
+            {
+                endpoint.stats->recordRead(0);
+                return 0;
+            }
+            waitUntil(lock, std::min(deadline, nextArrival(endpoint)));
+            now = Clock::now();
+        }
+        // The ring never wraps (ReadAheadBuffer compacts), so every pending byte is one region.
+        const auto region = endpoint.rx.readable();
+        endpoint.acquired = true;
+        endpoint.acquisition_cleared = false;
+        endpoint.acquired_size = region.size();
+        *data = region.data();
+        *size = static_cast<int>(region.size());
+        return *size;
+    });
+}
+
+auto Loopback::rxRelease(std::int64_t handle, int consumed) -> Status
+{
+    return withEndpoint(handle, [&](Lock &, Endpoint &endpoint) -> Status {
+        if (!endpoint.acquired)
+        {
+            // Only the first release after clearBufferIn() ended the acquisition is excused.
+            if (std::exchange(endpoint.acquisition_cleared, false))
+            {
+                return ok();
+            }
+            return fail(StatusCode::Io::kBufferError, "Nothing acquired");
+        }
+        if (consumed < 0 || static_cast<std::size_t>(consumed) > endpoint.acquired_size)
+        {
+            return fail(StatusCode::Io::kBufferError, "Consumed too much");
+        }
+        endpoint.rx.discard(static_cast<std::size_t>(consumed));
+        endpoint.acquired = false;
+        // Acquire + release count as one read call, with the bytes actually consumed.
+        if (consumed > 0)
+        {
+            endpoint.stats->recordRead(consumed);
+        }
+        syncWaitFd(endpoint);
+        changed_.notify_all();
+        return ok();
+    });
+}
+
+// Per-handle callbacks -------------------------------------------------------
+
+auto Loopback::setDataCallback(std::int64_t handle, DataCallbackT Endpoint::*callback, void *Endpoint::*user_data,
+                               DataCallbackT function, void *context) -> Status
+{
+    return withEndpoint(handle, [&](Lock &lock, Endpoint &endpoint) -> Status {
+        ++endpoint.registration;
+        changed_.wait(lock, [&] { return endpoint.callbacks_running == 0; });
+        endpoint.*callback = function;
+        endpoint.*user_data = context;
+        if (endpoint.read_callback == nullptr)
+        {
+            // Bytes not yet handed to the old callback were meant for it alone.
+            endpoint.callback_bytes.clear();
+        }
+        if (endpoint.read_callback != nullptr || endpoint.wait_fd >= 0)
+        {
+            watch(endpoint);
+        }
+        else
+        {
+            unwatch(endpoint);
+        }
+        return ok();
+    });
+}
+
+auto Loopback::setHandleReadCallback(std::int64_t handle, DataCallbackT callback, void *user_data) -> Status
+{
+    return setDataCallback(handle, &Endpoint::read_callback, &Endpoint::read_user_data, callback, user_data);
+}
+
+auto Loopback::setHandleWriteCallback(std::int64_t handle, DataCallbackT callback, void *user_data) -> Status
+{
+    return setDataCallback(handle, &Endpoint::write_callback, &Endpoint::write_user_data, callback, user_data);
+}
+
+auto Loopback::handOver(Lock &lock, Endpoint &endpoint, DataCallbackT callback, void *user_data,
+                        std::span<const std::byte> data) -> void
+{
+    const auto handle = endpoint.handle;
+    if (event_mode_.load(std::memory_order_relaxed))
+    {
+        queueOrRun(lock, [this, handle, registration = endpoint.registration, callback, user_data,
+                          bytes = std::vector<std::byte>(data.begin(), data.end())] {
+            runIfRegistered(handle, registration, [&] {
+                callback(handle, bytes.data(), static_cast<int>(bytes.size()), user_data);
+            });
+        });
+        return;
+    }
+    ++endpoint.callbacks_running;
+    lock.unlock();
+    callback(handle, data.data(), static_cast<int>(data.size()), user_data);
+    lock.lock();
+    --endpoint.callbacks_running;
+    changed_.notify_all();
+}
+
+auto Loopback::runIfRegistered(std::int64_t handle, std::uint64_t registration, const Event &event) -> void
+{
+    Endpoint *endpoint = nullptr;
+    {
+        const Lock lock(mutex_);
+        const auto found = handles_.find(handle);
+        if (found == handles_.end() || found->second->registration != registration)
+        {
+            return;
+        }
+        endpoint = found->second;
+        ++endpoint->callbacks_running;
+    }
+    event();
+    const Lock lock(mutex_);
+    --endpoint->callbacks_running;
+    changed_.notify_all();
+}
+
+// Pump -----------------------------------------------------------------------
+
+auto Loopback::watch(Endpoint &endpoint) -> void
+{
+    if (std::ranges::find(watched_, &endpoint) == watched_.end())
+    {
+        watched_.push_back(&endpoint);
+    }
+    if (!pump_.joinable())
+    {
+        pump_ = std::thread([this] { pumpLoop(); });
+    }
+    changed_.notify_all();
+}
+
+auto Loopback::unwatch(Endpoint &endpoint) -> void
+{
+    std::erase(watched_, &endpoint);
+}
+
+// Keeps wait handles and per-handle read callbacks current while no call is delivering bytes.
+auto Loopback::pumpLoop() -> void
+{
+    Lock lock(mutex_);
+    while (true)
+    {
+        const auto now = Clock::now();
+        auto wake = Clock::time_point::max();
+        Endpoint *pending = nullptr;
+        for (auto *endpoint : watched_)
+        {
+            deliver(*endpoint, now);
+            wake = std::min(wake, nextArrival(*endpoint));
+            if (pending == nullptr && endpoint->handle != 0 && !endpoint->callback_bytes.empty())
+            {
+                pending = endpoint;
+            }
+        }
+        if (pending != nullptr)
+        {
+            // One endpoint per pass: the lock is released around the callback and watched_ may change.
+            const auto bytes = std::exchange(pending->callback_bytes, {});
+            handOver(lock, *pending, pending->read_callback, pending->read_user_data, bytes);
+            if (auto *notify = read_notify_.load(std::memory_order_acquire); notify != nullptr)
+            {
+                queueOrRun(lock, [notify, size = static_cast<int>(bytes.size())] { notify(size); });
+            }
+            continue;
+        }
+        waitUntil(lock, wake);
+    }
+}
+
+// Submission queue -----------------------------------------------------------
+
+auto Loopback::submit(std::span<const QueueSubmission> entries) -> Result<int>
+{
+    const Lock lock(mutex_);
+    int accepted = 0;
+    for (const auto &entry : entries)
+    {
+        if (outstanding_ >= kQueueDepth)
+        {
+            break;
+        }
+        ++outstanding_;
+        ++accepted;
+        const auto found = handles_.find(entry.handle);
+        if (found == handles_.end())
+        {
+            completeLocked(entry, static_cast<int>(StatusCode::Connection::kInvalidHandleError));
+            continue;
+        }
+        if (const auto invalid = checkSubmission(entry); invalid != StatusCode::kSuccess)
+        {
+            completeLocked(entry, static_cast<int>(invalid));
+            continue;
+        }
+        auto &endpoint = *found->second;
+        const std::size_t direction = isWriteSide(entry.op) ? 1 : 0;
+        auto &worker = endpoint.workers[direction];
+        worker.queue.push_back(
+            Queued{.entry = entry,
+                   .generation = direction == 1 ? endpoint.write_generation : endpoint.read_generation});
+        if (!worker.running)
+        {
+            // A finished worker has already dropped the lock for good, so joining here cannot block on us.
+            if (worker.thread.joinable())
+            {
+                worker.thread.join();
+            }
+            worker.running = true;
+            worker.thread = std::thread([this, target = &endpoint, direction] { workerLoop(target, direction); });
+        }
+    }
+    return accepted;
+}
+
+auto Loopback::execute(Lock &lock, Endpoint &endpoint, const Queued &queued) -> int
+{
+    const auto &entry = queued.entry;
+    const auto size = static_cast<std::size_t>(entry.buffer_size);
+    const auto timing = Timing::perByte(entry.timeout_ms, entry.multiplier);
+    const auto *sequence = static_cast<const std::byte *>(entry.sequence);
+    std::span<const std::byte> terminator;
+    const auto op = static_cast<QueueOp>(entry.op);
+    const LatencyTimer timer(op == QueueOp::kWrite   ? LatencyOp::kWrite
+                             : op == QueueOp::kDrain ? LatencyOp::kDrain
+                             : op == QueueOp::kRead  ? LatencyOp::kRead
+                                                     : LatencyOp::kReadUntil,
+                             endpoint.latency.get(), aggregateLatency());
+    switch (op)
+    {
+    case QueueOp::kWrite: {
+        const auto result = writeLocked(lock, endpoint, queued.generation,
+                                        std::span(static_cast<const std::byte *>(entry.buffer), size), timing);
+        endpoint.stats->recordWrite(resultValue(result));
+        return static_cast<int>(resultValue(result));
+    }
+    case QueueOp::kDrain: {
+        const auto drained = drainLocked(lock, endpoint, queued.generation);
+        return drained ? 0 : static_cast<int>(drained.error().code);
+    }
+    case QueueOp::kReadLine:
+        terminator = kLineEnd;
+        break;
+    case QueueOp::kReadUntil:
+        terminator = std::span(sequence, 1);
+        break;
+    case QueueOp::kReadUntilSequence:
+        terminator = std::span(sequence, static_cast<std::size_t>(entry.sequence_size));
+        break;
+    case QueueOp::kRead:
+        break;
+    }
+    const auto result = readLocked(lock, endpoint, queued.generation,
+                                   std::span(static_cast<std::byte *>(entry.buffer), size), terminator, timing);
+    endpoint.stats->recordRead(resultValue(result));
+    return static_cast<int>(resultValue(result));
+}
+
+auto Loopback::workerLoop(Endpoint *endpoint, std::size_t direction) -> void
+{
+    Lock lock(mutex_);
+    auto &worker = endpoint->workers[direction];
+    while (!worker.queue.empty())
+    {
+        const auto queued = worker.queue.front();
+        worker.queue.pop_front();
+        ++endpoint->users;
+        const auto result = execute(lock, *endpoint, queued);
+        leave(*endpoint);
+        completeLocked(queued.entry, result);
+    }
+    worker.running = false;
+}
+
+auto Loopback::completeLocked(const QueueSubmission &entry, int result) -> void
+{
+    completions_.push_back(
+        QueueCompletion{.user_data = entry.user_data, .handle = entry.handle, .op = entry.op, .result = result});
+    syncEventFd();
+    changed_.notify_all();
+}
+
+auto Loopback::reap(std::span<QueueCompletion> out, int min_complete, int timeout_ms) -> Result<int>
+{
+    Lock lock(mutex_);
+    const auto wanted = std::min(static_cast<std::size_t>(std::max(min_complete, 0)), out.size());
+    const auto deadline = deadlineAfter(Clock::now(), timeout_ms);
+    while (completions_.size() < wanted && Clock::now() < deadline)
+    {
+        waitUntil(lock, deadline);
+    }
+    const auto count = std::min(out.size(), completions_.size());
+    std::copy_n(completions_.begin(), count, out.begin());
+    completions_.erase(completions_.begin(), completions_.begin() + static_cast<std::ptrdiff_t>(count));
+    outstanding_ -= count;
+    syncEventFd();
+    return static_cast<int>(count);
+}
+
+// Ports, events and global callbacks -----------------------------------------
+
+auto Loopback::listPorts(ListCallback callback) -> Result<int>
+{
+    std::vector<std::string> names;
+    {
+        const Lock lock(mutex_);
+        for (const auto &[name, device] : devices_)
+        {
+            for (const auto &end : device->ends)
+            {
+                names.push_back(end->path);
+            }
+        }
+    }
+    if (callback != nullptr)
+    {
+        for (const auto &name : names)
+        {
+            callback(name.c_str(), name.c_str(), "cpp_core loopback", nullptr, nullptr, nullptr, nullptr, nullptr);
+        }
+    }
+    return static_cast<int>(names.size());
+}
+
+auto Loopback::monitorPorts(MonitorCallback callback) -> void
+{
+    monitor_.store(callback, std::memory_order_release);
+}
+
+auto Loopback::emitPortEvents(const PortEvents &events) -> void
+{
+    auto *monitor = monitor_.load(std::memory_order_acquire);
+    if (monitor == nullptr)
+    {
+        return;
+    }
+    for (const auto &[event, name] : events)
+    {
+        emit([monitor, event, name] { monitor(event, name.c_str()); });
+    }
+}
+
+auto Loopback::eventHandle() -> Result<std::int64_t>
+{
+    const Lock lock(mutex_);
+    if (event_fd_ < 0)
+    {
+        const int descriptor = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (descriptor < 0)
+        {
+            return fail<std::int64_t>(StatusCode::Monitor::kMonitorError, "eventfd failed");
+        }
+        event_fd_ = descriptor;
+        event_mode_.store(true, std::memory_order_release);
+        syncEventFd();
+    }
+    return event_fd_;
+}
+
+auto Loopback::dispatchEvents(int max_events) -> Result<int>
+{
+    std::vector<Event> batch;
+    {
+        const Lock lock(mutex_);
+        while (batch.size() < static_cast<std::size_t>(max_events) && !events_.empty())
+        {
+            batch.push_back(std::move(events_.front()));
+            events_.pop_front();
+        }
+        syncEventFd();
+    }
+    for (const auto &event : batch)
+    {
+        event();
+    }
+    return static_cast<int>(batch.size());
+}
+
+auto Loopback::queueOrRun(Lock &lock, Event event) -> void
+{
+    if (event_mode_.load(std::memory_order_relaxed))
+    {
+        events_.push_back(std::move(event));
+        syncEventFd();
+        return;
+    }
+    lock.unlock();
+    event();
+    lock.lock();
+}
+
+auto Loopback::emit(Event event) -> void
+{
+    Lock lock(mutex_);
+    queueOrRun(lock, std::move(event));
+}
+
+auto Loopback::setReadCallback(void (*callback)(int)) -> void
+{
+    read_notify_.store(callback, std::memory_order_release);
+}
+
+auto Loopback::setWriteCallback(void (*callback)(int)) -> void
+{
+    write_notify_.store(callback, std::memory_order_release);
+}
+
+auto Loopback::setErrorCallback(ErrorCallbackT callback) -> void
+{
+    error_notify_.store(callback, std::memory_order_release);
+}
+
+auto Loopback::notifyRead(int bytes) -> void
+{
+    if (auto *notify = read_notify_.load(std::memory_order_acquire); notify != nullptr)
+    {
+        if (!event_mode_.load(std::memory_order_acquire))
+        {
+            notify(bytes);
+            return;
+        }
+        emit([notify, bytes] { notify(bytes); });
+    }
+}
+
+auto Loopback::notifyWrite(int bytes) -> void
+{
+    if (auto *notify = write_notify_.load(std::memory_order_acquire); notify != nullptr)
+    {
+        if (!event_mode_.load(std::memory_order_acquire))
+        {
+            notify(bytes);
+            return;
+        }
+        emit([notify, bytes] { notify(bytes); });
+    }
+}
+
+auto Loopback::notifyError(int code, const char *message) -> void
+{
+    if (auto *notify = error_notify_.load(std::memory_order_acquire); notify != nullptr)
+    {
+        if (!event_mode_.load(std::memory_order_acquire))
+        {
+            notify(code, message);
+            return;
+        }
+        emit([notify, code, text = std::string(message != nullptr ? message : "")] { notify(code, text.c_str()); });
+    }
+}
+
+// Pool -----------------------------------------------------------------------
+
+auto Loopback::setPoolOptions(int max_idle, int idle_timeout_ms) -> Status
+{
+    if (max_idle < 0 || idle_timeout_ms < 0)
+    {
+        return fail(StatusCode::Control::kSetStateError, "Invalid pool options");
+    }
+    pool_.setOptions(static_cast<std::size_t>(max_idle), std::chrono::milliseconds{idle_timeout_ms});
+    return ok();
+}
+
+auto Loopback::clearPool() -> Result<int>
+{
+    return static_cast<int>(pool_.clear());
+}
+
+} // namespace cpp_core::loopback
@@ -0,0 +1,415 @@
+#pragma once
+
+#include "cpp_core/capture.hpp"
+#include "cpp_core/data_callback.h"
+#include "cpp_core/error_callback.h"
+#include "cpp_core/handle_pool.hpp"
+#include "cpp_core/interface/serial_get_stats.h"
+#include "cpp_core/interface/serial_poll.h"
+#include "cpp_core/interface/serial_read_many.h"
+#include "cpp_core/interface/serial_reap.h"
+#include "cpp_core/interface/serial_submit.h"
+#include "cpp_core/io_vec.h"
+#include "cpp_core/latency_histogram.hpp"
+#include "cpp_core/read_ahead_buffer.hpp"
+#include "cpp_core/result.hpp"
+#include "cpp_core/serial_config.hpp"
+#include "cpp_core/stats_counters.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace cpp_core::loopback
+{
+
+using Clock = std::chrono::steady_clock;
+
+// Receive ring per endpoint; also the read-ahead buffer behind serialPeek() and serialRxAcquire().
+inline constexpr std::size_t kRxCapacity = 16 * 1024;
+// Bytes a writer may queue on the wire before serialWrite() starts to wait.
+inline constexpr std::size_t kTxCapacity = 4096;
+// Outstanding serialSubmit() operations across all handles.
+inline constexpr std::size_t kQueueDepth = 1024;
+
+inline constexpr std::string_view kScheme = "loop://";
+inline constexpr std::string_view kReplayScheme = "replay://";
+inline constexpr std::string_view kUnpacedSuffix = "?unpaced";
+inline constexpr std::string_view kSpeedQuery = "?speed=";
+inline constexpr std::array<std::byte, 1> kLineEnd{std::byte{'\n'}};
+
+/**
+ * Parsed loopback port name.
+ *   loop://NAME          echo port: everything written comes back, like a loopback plug
+ *   loop://NAME/0, /1    the two ends of a null-modem pair
+ *   replay://FILE        serves the received bytes and modem lines of a capture file at their recorded times
+ * A trailing "?unpaced" delivers written bytes at once instead of at the configured baud rate, or a whole
+ * capture as fast as it is read. "replay://FILE?speed=N" replays N times faster than recorded.
+ */
+struct PortPath
+{
+    std::string device; // "replay://FILE" for a replay port
+    int end = -1;       // -1 for an echo or replay port
+    bool paced = true;
+    std::string replay; // capture file of a replay port
+    double speed = 1.0;
+
+    [[nodiscard]] static auto parse(std::string_view path) -> std::optional<PortPath>;
+
+    // Canonical name without the "?unpaced" suffix, as reported by serialListPorts().
+    [[nodiscard]] auto name() const -> std::string;
+};
+
+// Time one character occupies on the wire: start bit, data bits, parity bit and stop bits at @p config baud rate.
+[[nodiscard]] auto characterTime(const SerialConfig &config) -> Clock::duration;
+
+// How long a call may wait: @p first before the first byte, @p next after each further byte (per-byte timeouts),
+// or @p first for the whole call when @p total is set. Negative means no limit.
+struct Timing
+{
+    int first = 0;
+    std::int64_t next = 0;
+    bool total = false;
+
+    [[nodiscard]] static constexpr auto perByte(int timeout_ms, int multiplier) -> Timing
+    {
+        return {timeout_ms, static_cast<std::int64_t>(timeout_ms) * multiplier, false};
+    }
+
+    [[nodiscard]] static constexpr auto forTotal(int total_timeout_ms) -> Timing
+    {
+        return {total_timeout_ms, 0, true};
+    }
+
+    [[nodiscard]] static constexpr auto immediate() -> Timing
+    {
+        return {0, 0, false};
+    }
+};
+
+/**
+ * Read-only mapping of a capture file behind a replay:// port: a multi-GB log is paged in as the replay
+ * reaches it instead of being loaded, and records are parsed in place.
+ */
+class MappedFile
+{
+  public:
+    [[nodiscard]] static auto tryMap(const std::string &path) -> Result<MappedFile>;
+
+    MappedFile(const MappedFile &) = delete;
+    auto operator=(const MappedFile &) -> MappedFile & = delete;
+    MappedFile(MappedFile &&other) noexcept;
+    auto operator=(MappedFile &&) -> MappedFile & = delete;
+    ~MappedFile();
+
+    [[nodiscard]] auto bytes() const noexcept -> std::span<const std::byte>
+    {
+        return bytes_;
+    }
+
+  private:
+    explicit MappedFile(std::span<const std::byte> bytes) noexcept : bytes_(bytes)
+    {
+    }
+
+    std::span<const std::byte> bytes_;
+};
+
+// Position of a replay:// port in its capture.
+struct Replay
+{
+    MappedFile file;
+    capture::Reader reader;
+    std::optional<capture::Record> pending; // next record not yet fully delivered
+    std::size_t offset = 0;                 // bytes of pending already delivered
+    Clock::time_point origin;               // when the capture's first record is due
+    std::int64_t first_ns = 0;
+    double speed = 1.0;
+    bool paced = true;
+    std::uint8_t lines = 0; // capture::LineBit state last replayed
+
+    [[nodiscard]] static auto tryOpen(const PortPath &path, Clock::time_point now) -> Result<std::unique_ptr<Replay>>;
+
+    [[nodiscard]] auto dueAt(const capture::Record &record) const -> Clock::time_point;
+};
+
+struct PoolTraits
+{
+    using handle_type = std::int64_t;
+
+    static constexpr auto invalid() noexcept -> handle_type
+    {
+        return 0;
+    }
+
+    static auto close(handle_type handle) noexcept -> void;
+};
+
+/**
+ * In-process serial devices behind the loopback binding (serial_loopback.cpp).
+ * Every handle is one endpoint. Written bytes queue on the writer's wire and arrive in the peer's receive
+ * ring one character time apart, so throughput, Drain() and timeouts behave like a real line at the configured
+ * baud rate. Modem lines are crossed the way a null-modem cable does it: my RTS is the peer's CTS, my DTR its DSR
+ * and DCD. With RTS/CTS flow control a full receive ring lowers RTS and the sender pauses; without it surplus
+ * bytes are dropped and counted as overruns.
+ *
+ * One mutex guards all state. Blocking calls wait on one condition variable until the next byte is due, data
+ * arrives or their abort generation changes, so an idle port costs no thread and no timer. A pump thread only
+ * runs while some endpoint has a wait handle or a per-handle read callback that must see bytes without a call.
+ */
+class Loopback
+{
+  public:
+    // Process-wide instance; never destroyed, so parked pool handles and detached threads stay safe at exit.
+    [[nodiscard]] static auto instance() -> Loopback &;
+
+    Loopback(const Loopback &) = delete;
+    auto operator=(const Loopback &) -> Loopback & = delete;
+    Loopback(Loopback &&) = delete;
+    auto operator=(Loopback &&) -> Loopback & = delete;
+
+    [[nodiscard]] auto open(std::string_view path, const SerialConfig &config) -> Result<std::int64_t>;
+    [[nodiscard]] auto close(std::int64_t handle) -> Status;
+    // Close without consulting the pool; PoolTraits::close() ends here.
+    [[nodiscard]] auto closeNow(std::int64_t handle) -> Status;
+
+    [[nodiscard]] auto read(std::int64_t handle, std::span<std::byte> out, std::span<const std::byte> terminator,
+                            Timing timing) -> Result<int>;
+    [[nodiscard]] auto readV(std::int64_t handle, std::span<const IoVec> buffers, Timing timing) -> Result<int>;
+    [[nodiscard]] auto peek(std::int64_t handle, std::span<std::byte> out, int timeout_ms) -> Result<int>;
+    [[nodiscard]] auto write(std::int64_t handle, std::span<const std::byte> data, Timing timing) -> Result<int>;
+    [[nodiscard]] auto writeV(std::int64_t handle, std::span<const IoVec> buffers, Timing timing) -> Result<int>;
+
+    [[nodiscard]] auto drain(std::int64_t handle) -> Status;
+    [[nodiscard]] auto clearBufferIn(std::int64_t handle) -> Status;
+    [[nodiscard]] auto clearBufferOut(std::int64_t handle) -> Status;
+    [[nodiscard]] auto abortRead(std::int64_t handle) -> Status;
+    [[nodiscard]] auto abortWrite(std::int64_t handle) -> Status;
+
+    [[nodiscard]] auto inBytesWaiting(std::int64_t handle) -> Result<int>;
+    [[nodiscard]] auto outBytesWaiting(std::int64_t handle) -> Result<int>;
+    [[nodiscard]] auto inBytesTotal(std::int64_t handle) -> Result<std::int64_t>;
+    [[nodiscard]] auto outBytesTotal(std::int64_t handle) -> Result<std::int64_t>;
+    [[nodiscard]] auto stats(std::int64_t handle, SerialStats &out) -> Status;
+    // Handle 0 selects the binding-wide histograms.
+    [[nodiscard]] auto latencyHistogram(std::int64_t handle, LatencyOp op, std::span<LatencyBucket> out)
+        -> Result<int>;
+    [[nodiscard]] auto setLatencyHistograms(bool enabled) -> Status;
+    // Tee the handle's traffic, modem lines and configuration into a capture file.
+    [[nodiscard]] auto captureStart(std::int64_t handle, const char *path) -> Status;
+    [[nodiscard]] auto captureStop(std::int64_t handle) -> Status;
+
+    [[nodiscard]] auto config(std::int64_t handle) -> Result<SerialConfig>;
+    [[nodiscard]] auto configure(std::int64_t handle, const SerialConfig &wanted) -> Status;
+
+    [[nodiscard]] auto setDtr(std::int64_t handle, bool state) -> Status;
+    [[nodiscard]] auto setRts(std::int64_t handle, bool state) -> Status;
+    [[nodiscard]] auto cts(std::int64_t handle) -> Result<bool>;
+    [[nodiscard]] auto dsr(std::int64_t handle) -> Result<bool>;
+    [[nodiscard]] auto dcd(std::int64_t handle) -> Result<bool>;
+    [[nodiscard]] auto ri(std::int64_t handle) -> Result<bool>;
+    [[nodiscard]] auto sendBreak(std::int64_t handle, int duration_ms) -> Status;
+
+    [[nodiscard]] auto waitHandle(std::int64_t handle) -> Result<std::int64_t>;
+    [[nodiscard]] auto poll(std::span<PollEntry> entries, int timeout_ms) -> Result<int>;
+    [[nodiscard]] auto readMany(std::span<ReadManyEntry> entries, int timeout_ms) -> Result<int>;
+    [[nodiscard]] auto rxAcquire(std::int64_t handle, const void **data, int *size, int timeout_ms) -> Result<int>;
+    [[nodiscard]] auto rxRelease(std::int64_t handle, int consumed) -> Status;
+
+    [[nodiscard]] auto setHandleReadCallback(std::int64_t handle, DataCallbackT callback, void *user_data) -> Status;
+    [[nodiscard]] auto setHandleWriteCallback(std::int64_t handle, DataCallbackT callback, void *user_data)
+        -> Status;
+
+    [[nodiscard]] auto submit(std::span<const QueueSubmission> entries) -> Result<int>;
+    [[nodiscard]] auto reap(std::span<QueueCompletion> out, int min_complete, int timeout_ms) -> Result<int>;
+
+    using ListCallback = void (*)(const char *, const char *, const char *, const char *, const char *, const char *,
+                                  const char *, const char *);
+    using MonitorCallback = void (*)(int, const char *);
+
+    [[nodiscard]] auto listPorts(ListCallback callback) -> Result<int>;
+    auto monitorPorts(MonitorCallback callback) -> void;
+
+    [[nodiscard]] auto eventHandle() -> Result<std::int64_t>;
+    [[nodiscard]] auto dispatchEvents(int max_events) -> Result<int>;
+
+    auto setReadCallback(void (*callback)(int)) -> void;
+    auto setWriteCallback(void (*callback)(int)) -> void;
+    auto setErrorCallback(ErrorCallbackT callback) -> void;
+    // Global serialSetReadCallback() / serialSetWriteCallback() / serialSetErrorCallback() notifications.
+    auto notifyRead(int bytes) -> void;
+    auto notifyWrite(int bytes) -> void;
+    auto notifyError(int code, const char *message) -> void;
+
+    [[nodiscard]] auto setPoolOptions(int max_idle, int idle_timeout_ms) -> Status;
+    [[nodiscard]] auto clearPool() -> Result<int>;
+
+  private:
+    Loopback() = default;
+
+    struct Line
+    {
+        std::deque<std::byte> bytes;
+        Clock::time_point head_start; // when the first queued byte started to shift out
+        Clock::time_point idle_from;  // the line is held in break until then
+    };
+
+    struct Queued
+    {
+        QueueSubmission entry;
+        std::uint64_t generation;
+    };
+
+    struct Worker
+    {
+        std::deque<Queued> queue;
+        std::thread thread;
+        bool running = false;
+    };
+
+    struct Endpoint
+    {
+        std::string device;
+        std::string path;      // canonical name
+        std::string opened_as; // name passed to serialOpen(), the pool key
+        Endpoint *peer = nullptr;
+        std::int64_t handle = 0; // 0 while closed
+        bool closing = false;
+        bool paced = true;
+        SerialConfig config{};
+        bool dtr = false;
+        bool rts = false;
+
+        ReadAheadBuffer<kRxCapacity> rx;
+        bool acquired = false;
+        bool acquisition_cleared = false;
+        std::size_t acquired_size = 0;
+        Line tx;
+
+        std::optional<StatsCounters> stats;
+        std::unique_ptr<LatencyHistograms> latency; // only while serialSetLatencyHistograms() is on at open
+        std::unique_ptr<capture::Recorder> capture; // between serialCaptureStart() and serialCaptureStop()
+        std::unique_ptr<Replay> replay;             // replay:// ports only
+        std::int64_t overrun_errors = 0;
+        std::int64_t breaks = 0;
+        std::uint64_t read_generation = 0; // bumped by serialAbortRead()
+        std::uint64_t write_generation = 0;
+        int users = 0; // calls and queued operations currently inside this endpoint
+
+        int wait_fd = -1;
+        bool wait_signaled = false;
+
+        DataCallbackT read_callback = nullptr;
+        void *read_user_data = nullptr;
+        std::vector<std::byte> callback_bytes;
+        DataCallbackT write_callback = nullptr;
+        void *write_user_data = nullptr;
+        std::uint64_t registration = 0; // bumped whenever a per-handle callback changes
+        int callbacks_running = 0;
+
+        std::array<Worker, 2> workers; // serialSubmit() reads / writes
+    };
+
+    struct Device
+    {
+        std::vector<std::unique_ptr<Endpoint>> ends;
+    };
+
+    using Lock = std::unique_lock<std::mutex>;
+    using Event = std::function<void()>;
+    using PortEvents = std::vector<std::pair<int, std::string>>;
+
+    // Bring a handle serialClose() parks to the state of a closed port, keeping only its line settings;
+    // unpark() raises DTR and RTS again when serialOpen() takes it back.
+    [[nodiscard]] auto park(std::int64_t handle) -> Status;
+    auto unpark(std::int64_t handle, Clock::time_point started) -> void;
+
+    [[nodiscard]] auto find(std::int64_t handle) -> Result<Endpoint *>;
+    // Run @p body with the handle's endpoint pinned: serialClose() waits until it returns.
+    template <typename Body> auto withEndpoint(std::int64_t handle, Body &&body);
+    auto leave(Endpoint &endpoint) -> void;
+    auto waitUntil(Lock &lock, Clock::time_point until) -> void;
+    [[nodiscard]] auto aggregateLatency() noexcept -> LatencyHistograms *;
+
+    [[nodiscard]] static auto lineRts(const Endpoint &endpoint) -> bool;
+    [[nodiscard]] static auto lineState(const Endpoint &endpoint) -> std::uint8_t;
+    [[nodiscard]] static auto nextArrival(const Endpoint &receiver) -> Clock::time_point;
+    [[nodiscard]] static auto nextReplayed(const Endpoint &receiver) -> Clock::time_point;
+    auto deliver(Endpoint &receiver, Clock::time_point now) -> void;
+    auto deliverReplayed(Endpoint &receiver, Clock::time_point now) -> void;
+    // Record the modem lines of @p endpoint and its peer, for whichever of them is capturing.
+    static auto captureLines(Endpoint &endpoint, Clock::time_point now) -> void;
+    auto enqueue(Endpoint &sender, std::span<const std::byte> data, Clock::time_point now) -> void;
+    static auto syncWaitFd(Endpoint &endpoint) -> void;
+    auto syncEventFd() -> void;
+
+    [[nodiscard]] auto readLocked(Lock &lock, Endpoint &endpoint, std::uint64_t generation, std::span<std::byte> out,
+                                  std::span<const std::byte> terminator, Timing timing) -> Result<int>;
+    [[nodiscard]] auto writeLocked(Lock &lock, Endpoint &endpoint, std::uint64_t generation,
+                                   std::span<const std::byte> data, Timing timing) -> Result<int>;
+    [[nodiscard]] auto drainLocked(Lock &lock, Endpoint &endpoint, std::uint64_t generation) -> Status;
+    [[nodiscard]] auto pollLocked(Lock &lock, std::span<PollEntry> entries, int timeout_ms) -> int;
+    [[nodiscard]] auto modemLine(std::int64_t handle, capture::LineBit line) -> Result<bool>;
+    [[nodiscard]] auto setLine(std::int64_t handle, bool Endpoint::*line, bool state) -> Status;
+    [[nodiscard]] auto setDataCallback(std::int64_t handle, DataCallbackT Endpoint::*callback,
+                                       void *Endpoint::*user_data, DataCallbackT function, void *context) -> Status;
+
+    [[nodiscard]] auto execute(Lock &lock, Endpoint &endpoint, const Queued &queued) -> int;
+    auto workerLoop(Endpoint *endpoint, std::size_t direction) -> void;
+    auto completeLocked(const QueueSubmission &entry, int result) -> void;
+
+    auto watch(Endpoint &endpoint) -> void;
+    auto unwatch(Endpoint &endpoint) -> void;
+    auto pumpLoop() -> void;
+    // Hand @p data to a per-handle callback: run it now (lock released) or queue a copy in event-loop mode.
+    auto handOver(Lock &lock, Endpoint &endpoint, DataCallbackT callback, void *user_data,
+                  std::span<const std::byte> data) -> void;
+    auto runIfRegistered(std::int64_t handle, std::uint64_t registration, const Event &event) -> void;
+    auto queueOrRun(Lock &lock, Event event) -> void;
+    auto emit(Event event) -> void;
+    auto emitPortEvents(const PortEvents &events) -> void;
+
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    std::map<std::string, std::unique_ptr<Device>, std::less<>> devices_;
+    std::unordered_map<std::int64_t, Endpoint *> handles_;
+    std::int64_t next_handle_ = 1;
+
+    std::vector<Endpoint *> watched_; // endpoints the pump thread keeps delivering to
+    std::thread pump_;
+
+    std::deque<QueueCompletion> completions_;
+    std::size_t outstanding_ = 0;
+
+    std::atomic<bool> event_mode_{false};
+    int event_fd_ = -1;
+    bool event_signaled_ = false;
+    std::deque<Event> events_;
+
+    std::atomic<void (*)(int)> read_notify_{nullptr};
+    std::atomic<void (*)(int)> write_notify_{nullptr};
+    std::atomic<ErrorCallbackT> error_notify_{nullptr};
+    std::atomic<MonitorCallback> monitor_{nullptr};
+
+    std::atomic<bool> latency_enabled_{false};
+    LatencyHistograms latency_all_;
+
+    HandlePool<PoolTraits> pool_;
+};
+
+} // namespace cpp_core::loopback
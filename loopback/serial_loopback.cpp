@@ -0,0 +1,872 @@
+// C ABI of the loopback binding: the same argument validation as the OS bindings, then one call into Loopback.
+// Every failure is also reported to the serialSetErrorCallback() callback, before the caller's own callback.
+
+#include "loopback.hpp"
+
+#include "cpp_core/serial.h"
+#include "cpp_core/status_table.hpp"
+#include "cpp_core/trace.hpp"
+#include "cpp_core/validation.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <span>
+
+namespace
+{
+
+using cpp_core::Result;
+using cpp_core::SerialConfig;
+using cpp_core::Status;
+using cpp_core::StatusCode;
+using cpp_core::loopback::Loopback;
+using cpp_core::loopback::Timing;
+
+thread_local ErrorCallbackT t_caller_callback = nullptr;
+
+auto reportError(int code, const char *message) -> void
+{
+    // Read first: the global callback may call back into the binding and replace it.
+    const auto caller = t_caller_callback;
+    Loopback::instance().notifyError(code, message);
+    if (caller != nullptr)
+    {
+        caller(code, message);
+    }
+}
+
+// Error callback for one ABI call: the global notification plus the caller's callback.
+auto reporting(ErrorCallbackT error_callback) -> ErrorCallbackT
+{
+    t_caller_callback = error_callback;
+    return &reportError;
+}
+
+auto loopback() -> Loopback &
+{
+    return Loopback::instance();
+}
+
+auto bytes(void *buffer, int buffer_size) -> std::span<std::byte>
+{
+    return {static_cast<std::byte *>(buffer), static_cast<std::size_t>(buffer_size)};
+}
+
+auto bytes(const void *buffer, int buffer_size) -> std::span<const std::byte>
+{
+    return {static_cast<const std::byte *>(buffer), static_cast<std::size_t>(buffer_size)};
+}
+
+auto terminatorOf(const void *sequence) -> std::span<const std::byte>
+{
+    return {static_cast<const std::byte *>(sequence), std::strlen(static_cast<const char *>(sequence))};
+}
+
+// 0 if @p handle and the buffer may be passed on, otherwise the reported status.
+auto checkTransfer(int64_t handle, const void *buffer, int buffer_size, ErrorCallbackT callback) -> int
+{
+    if (const int invalid = cpp_core::validateHandle<int>(handle, callback); invalid < 0)
+    {
+        return invalid;
+    }
+    return cpp_core::validateBuffer<int>(buffer, buffer_size, callback);
+}
+
+auto checkSequence(const void *sequence, ErrorCallbackT callback) -> int
+{
+    if (sequence == nullptr || *static_cast<const char *>(sequence) == '\0')
+    {
+        return cpp_core::failMsg<int>(callback, StatusCode::Io::kBufferError, "Empty terminator");
+    }
+    return 0;
+}
+
+auto finishRead(const Result<int> &result, ErrorCallbackT callback) -> int
+{
+    if (result && *result > 0)
+    {
+        loopback().notifyRead(*result);
+    }
+    return cpp_core::toCResult(result, callback);
+}
+
+auto finishWrite(const Result<int> &result, ErrorCallbackT callback) -> int
+{
+    if (result && *result > 0)
+    {
+        loopback().notifyWrite(*result);
+    }
+    return cpp_core::toCResult(result, callback);
+}
+
+auto readCall(int64_t handle, void *buffer, int buffer_size, std::span<const std::byte> terminator, Timing timing,
+              ErrorCallbackT callback) -> int
+{
+    if (const int invalid = checkTransfer(handle, buffer, buffer_size, callback); invalid < 0)
+    {
+        return invalid;
+    }
+    return finishRead(loopback().read(handle, bytes(buffer, buffer_size), terminator, timing), callback);
+}
+
+auto writeCall(int64_t handle, const void *buffer, int buffer_size, Timing timing, ErrorCallbackT callback) -> int
+{
+    if (const int invalid = checkTransfer(handle, buffer, buffer_size, callback); invalid < 0)
+    {
+        return invalid;
+    }
+    return finishWrite(loopback().write(handle, bytes(buffer, buffer_size), timing), callback);
+}
+
+auto handleCall(int64_t handle, ErrorCallbackT callback, auto &&call) -> int
+{
+    if (const int invalid = cpp_core::validateHandle<int>(handle, callback); invalid < 0)
+    {
+        return invalid;
+    }
+    const auto result = call();
+    if constexpr (std::is_same_v<std::remove_cvref_t<decltype(result)>, Status>)
+    {
+        return cpp_core::toCStatus(result, callback);
+    }
+    else
+    {
+        return static_cast<int>(cpp_core::toCResult(result, callback));
+    }
+}
+
+auto modemCall(int64_t handle, ErrorCallbackT callback, Result<bool> (Loopback::*line)(std::int64_t)) -> int
+{
+    return handleCall(handle, callback, [&] {
+        return (loopback().*line)(handle).transform([](bool state) { return state ? 1 : 0; });
+    });
+}
+
+// Read-modify-write of one line setting; serialConfigure() validates and reports the field's error code.
+auto reconfigure(int64_t handle, ErrorCallbackT callback, auto &&change) -> int
+{
+    return handleCall(handle, callback, [&] {
+        return loopback().config(handle).and_then([&](SerialConfig config) {
+            change(config);
+            return loopback().configure(handle, config);
+        });
+    });
+}
+
+} // namespace
+
+extern "C"
+{
+
+    auto serialOpen(void *port, int baudrate, int data_bits, int parity, int stop_bits,
+                    ErrorCallbackT error_callback) -> intptr_t
+    {
+        return CPP_CORE_TRACED(0, [&] -> intptr_t {
+            const auto callback = reporting(error_callback);
+            if (const auto invalid = cpp_core::validateOpenParams<intptr_t>(port, baudrate, data_bits, callback);
+                invalid < 0)
+            {
+                return invalid;
+            }
+            const auto opened =
+                SerialConfig::tryMake(baudrate, data_bits, static_cast<cpp_core::Parity>(parity),
+                                      static_cast<cpp_core::StopBits>(stop_bits))
+                    .and_then([&](const SerialConfig &config) {
+                        return loopback().open(static_cast<const char *>(port), config);
+                    });
+            return static_cast<intptr_t>(cpp_core::toCResult(opened, callback));
+        });
+    }
+
+    auto serialClose(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            if (handle <= 0)
+            {
+                return 0;
+            }
+            return cpp_core::toCStatus(loopback().close(handle), reporting(error_callback));
+        });
+    }
+
+    auto serialConfigure(int64_t handle, const cpp_core::SerialLineConfig *config, ErrorCallbackT error_callback)
+        -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            const auto callback = reporting(error_callback);
+            if (config == nullptr)
+            {
+                return cpp_core::failMsg<int>(callback, StatusCode::Control::kSetStateError, "Config is nullptr");
+            }
+            return handleCall(handle, callback,
+                              [&] { return loopback().configure(handle, cpp_core::fromLineConfig(*config)); });
+        });
+    }
+
+    auto serialSetBaudrate(int64_t handle, int baudrate, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return reconfigure(handle, reporting(error_callback),
+                               [&](SerialConfig &config) { config.baudrate = baudrate; });
+        });
+    }
+
+    auto serialSetDataBits(int64_t handle, int data_bits, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return reconfigure(handle, reporting(error_callback),
+                               [&](SerialConfig &config) { config.data_bits = data_bits; });
+        });
+    }
+
+    auto serialSetParity(int64_t handle, int parity, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return reconfigure(handle, reporting(error_callback),
+                               [&](SerialConfig &config) { config.parity = static_cast<cpp_core::Parity>(parity); });
+        });
+    }
+
+    auto serialSetStopBits(int64_t handle, int stop_bits, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return reconfigure(handle, reporting(error_callback), [&](SerialConfig &config) {
+                config.stop_bits = static_cast<cpp_core::StopBits>(stop_bits);
+            });
+        });
+    }
+
+    auto serialSetFlowControl(int64_t handle, int mode, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return reconfigure(handle, reporting(error_callback), [&](SerialConfig &config) {
+                config.flow_control = static_cast<cpp_core::FlowControl>(mode);
+            });
+        });
+    }
+
+    auto serialGetBaudrate(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return handleCall(handle, reporting(error_callback), [&] {
+                return loopback().config(handle).transform([](const SerialConfig &config) { return config.baudrate; });
+            });
+        });
+    }
+
+    auto serialGetDataBits(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return handleCall(handle, reporting(error_callback), [&] {
+                return loopback().config(handle).transform([](const SerialConfig &config) { return config.data_bits; });
+            });
+        });
+    }
+
+    auto serialGetParity(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return handleCall(handle, reporting(error_callback), [&] {
+                return loopback().config(handle).transform(
+                    [](const SerialConfig &config) { return config.parityInt(); });
+            });
+        });
+    }
+
+    auto serialGetStopBits(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return handleCall(handle, reporting(error_callback), [&] {
+                return loopback().config(handle).transform(
+                    [](const SerialConfig &config) { return config.stopBitsInt(); });
+            });
+        });
+    }
+
+    auto serialGetFlowControl(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return handleCall(handle, reporting(error_callback), [&] {
+                return loopback().config(handle).transform(
+                    [](const SerialConfig &config) { return config.flowControlInt(); });
+            });
+        });
+    }
+
+    auto serialRead(int64_t handle, void *buffer, int buffer_size, int timeout_ms, int multiplier,
+                    ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return readCall(handle, buffer, buffer_size, {}, Timing::perByte(timeout_ms, multiplier),
+                            reporting(error_callback));
+        });
+    }
+
+    auto serialReadFor(int64_t handle, void *buffer, int buffer_size, int total_timeout_ms,
+                       ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return readCall(handle, buffer, buffer_size, {}, Timing::forTotal(total_timeout_ms),
+                            reporting(error_callback));
+        });
+    }
+
+    auto serialReadLine(int64_t handle, void *buffer, int buffer_size, int timeout_ms, int multiplier,
+                        ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return readCall(handle, buffer, buffer_size, cpp_core::loopback::kLineEnd,
+                            Timing::perByte(timeout_ms, multiplier), reporting(error_callback));
+        });
+    }
+
+    auto serialReadLineFor(int64_t handle, void *buffer, int buffer_size, int total_timeout_ms,
+                           ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return readCall(handle, buffer, buffer_size, cpp_core::loopback::kLineEnd,
+                            Timing::forTotal(total_timeout_ms), reporting(error_callback));
+        });
+    }
+
+    auto serialReadUntil(int64_t handle, void *buffer, int buffer_size, int timeout_ms, int multiplier,
+                         void *until_char, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            const auto callback = reporting(error_callback);
+            if (until_char == nullptr)
+            {
+                return cpp_core::failMsg<int>(callback, StatusCode::Io::kBufferError, "Terminator is nullptr");
+            }
+            return readCall(handle, buffer, buffer_size, bytes(static_cast<const void *>(until_char), 1),
+                            Timing::perByte(timeout_ms, multiplier), callback);
+        });
+    }
+
+    auto serialReadUntilFor(int64_t handle, void *buffer, int buffer_size, int total_timeout_ms, void *until_char,
+                            ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            const auto callback = reporting(error_callback);
+            if (until_char == nullptr)
+            {
+                return cpp_core::failMsg<int>(callback, StatusCode::Io::kBufferError, "Terminator is nullptr");
+            }
+            return readCall(handle, buffer, buffer_size, bytes(static_cast<const void *>(until_char), 1),
+                            Timing::forTotal(total_timeout_ms), callback);
+        });
+    }
+
+    auto serialReadUntilSequence(int64_t handle, void *buffer, int buffer_size, int timeout_ms, int multiplier,
+                                 void *sequence, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            const auto callback = reporting(error_callback);
+            if (const int invalid = checkSequence(sequence, callback); invalid < 0)
+            {
+                return invalid;
+            }
+            return readCall(handle, buffer, buffer_size, terminatorOf(sequence),
+                            Timing::perByte(timeout_ms, multiplier), callback);
+        });
+    }
+
+    auto serialReadUntilSequenceFor(int64_t handle, void *buffer, int buffer_size, int total_timeout_ms,
+                                    void *sequence, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            const auto callback = reporting(error_callback);
+            if (const int invalid = checkSequence(sequence, callback); invalid < 0)
+            {
+                return invalid;
+            }
+            return readCall(handle, buffer, buffer_size, terminatorOf(sequence), Timing::forTotal(total_timeout_ms),
+                            callback);
+        });
+    }
+
+    auto serialReadV(int64_t handle, const cpp_core::IoVec *buffers, int buffer_count, int timeout_ms, int multiplier,
+                     ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            const auto callback = reporting(error_callback);
+            if (const int invalid = cpp_core::validateHandle<int>(handle, callback); invalid < 0)
+            {
+                return invalid;
+            }
+            if (const int invalid = cpp_core::validateIoVec<int>(buffers, buffer_count, callback); invalid < 0)
+            {
+                return invalid;
+            }
+            return finishRead(loopback().readV(handle, std::span(buffers, static_cast<std::size_t>(buffer_count)),
+                                               Timing::perByte(timeout_ms, multiplier)),
+                              callback);
+        });
+    }
+
+    auto serialPeek(int64_t handle, void *buffer, int buffer_size, int timeout_ms, ErrorCallbackT error_callback)
+        -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            const auto callback = reporting(error_callback);
+            if (const int invalid = checkTransfer(handle, buffer, buffer_size, callback); invalid < 0)
+            {
+                return invalid;
+            }
+            return cpp_core::toCResult(loopback().peek(handle, bytes(buffer, buffer_size), timeout_ms), callback);
+        });
+    }
+
+    auto serialWrite(int64_t handle, const void *buffer, int buffer_size, int timeout_ms, int multiplier,
+                     ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return writeCall(handle, buffer, buffer_size, Timing::perByte(timeout_ms, multiplier),
+                             reporting(error_callback));
+        });
+    }
+
+    auto serialWriteFor(int64_t handle, const void *buffer, int buffer_size, int total_timeout_ms,
+                        ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return writeCall(handle, buffer, buffer_size, Timing::forTotal(total_timeout_ms),
+                             reporting(error_callback));
+        });
+    }
+
+    auto serialWriteV(int64_t handle, const cpp_core::IoVec *buffers, int buffer_count, int timeout_ms,
+                      int multiplier, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            const auto callback = reporting(error_callback);
+            if (const int invalid = cpp_core::validateHandle<int>(handle, callback); invalid < 0)
+            {
+                return invalid;
+            }
+            if (const int invalid = cpp_core::validateIoVec<int>(buffers, buffer_count, callback); invalid < 0)
+            {
+                return invalid;
+            }
+            return finishWrite(loopback().writeV(handle, std::span(buffers, static_cast<std::size_t>(buffer_count)),
+                                                 Timing::perByte(timeout_ms, multiplier)),
+                               callback);
+        });
+    }
+
+    auto serialInBytesWaiting(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return handleCall(handle, reporting(error_callback), [&] { return loopback().inBytesWaiting(handle); });
+        });
+    }
+
+    auto serialOutBytesWaiting(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return handleCall(handle, reporting(error_callback), [&] { return loopback().outBytesWaiting(handle); });
+        });
+    }
+
+    auto serialInBytesTotal(int64_t handle, ErrorCallbackT error_callback) -> int64_t
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int64_t {
+            const auto callback = reporting(error_callback);
+            if (const auto invalid = cpp_core::validateHandle<int64_t>(handle, callback); invalid < 0)
+            {
+                return invalid;
+            }
+            return cpp_core::toCResult(loopback().inBytesTotal(handle), callback);
+        });
+    }
+
+    auto serialOutBytesTotal(int64_t handle, ErrorCallbackT error_callback) -> int64_t
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int64_t {
+            const auto callback = reporting(error_callback);
+            if (const auto invalid = cpp_core::validateHandle<int64_t>(handle, callback); invalid < 0)
+            {
+                return invalid;
+            }
+            return cpp_core::toCResult(loopback().outBytesTotal(handle), callback);
+        });
+    }
+
+    auto serialGetStats(int64_t handle, cpp_core::SerialStats *out, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            const auto callback = reporting(error_callback);
+            if (out == nullptr)
+            {
+                return cpp_core::failMsg<int>(callback, StatusCode::Io::kBufferError, "Stats output is nullptr");
+            }
+            return handleCall(handle, callback, [&] { return loopback().stats(handle, *out); });
+        });
+    }
+
+    auto serialGetLatencyHistogram(int64_t handle, int op, cpp_core::LatencyBucket *buckets, int bucket_count,
+                                   ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            const auto callback = reporting(error_callback);
+            if (!cpp_core::LatencyHistograms::isOp(op) || bucket_count < 0 || (bucket_count > 0 && buckets == nullptr))
+            {
+                return cpp_core::failMsg<int>(callback, StatusCode::Io::kBufferError, "Invalid op or buckets");
+            }
+            if (handle != 0)
+            {
+                if (const int invalid = cpp_core::validateHandle<int>(handle, callback); invalid < 0)
+                {
+                    return invalid;
+                }
+            }
+            const auto out = std::span(buckets, static_cast<std::size_t>(bucket_count));
+            return cpp_core::toCResult(loopback().latencyHistogram(handle, static_cast<cpp_core::LatencyOp>(op), out),
+                                       callback);
+        });
+    }
+
+    auto serialSetLatencyHistograms(int enabled, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(0, [&] -> int {
+            return cpp_core::toCStatus(loopback().setLatencyHistograms(enabled != 0), reporting(error_callback));
+        });
+    }
+
+    auto serialCaptureStart(int64_t handle, const char *path, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            const auto callback = reporting(error_callback);
+            if (path == nullptr)
+            {
+                return cpp_core::failMsg<int>(callback, StatusCode::Io::kBufferError, "Path is nullptr");
+            }
+            return handleCall(handle, callback, [&] { return loopback().captureStart(handle, path); });
+        });
+    }
+
+    auto serialCaptureStop(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return handleCall(handle, reporting(error_callback), [&] { return loopback().captureStop(handle); });
+        });
+    }
+
+    auto serialDrain(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return handleCall(handle, reporting(error_callback), [&] { return loopback().drain(handle); });
+        });
+    }
+
+    auto serialClearBufferIn(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return handleCall(handle, reporting(error_callback), [&] { return loopback().clearBufferIn(handle); });
+        });
+    }
+
+    auto serialClearBufferOut(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return handleCall(handle, reporting(error_callback), [&] { return loopback().clearBufferOut(handle); });
+        });
+    }
+
+    auto serialAbortRead(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return handleCall(handle, reporting(error_callback), [&] { return loopback().abortRead(handle); });
+        });
+    }
+
+    auto serialAbortWrite(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return handleCall(handle, reporting(error_callback), [&] { return loopback().abortWrite(handle); });
+        });
+    }
+
+    auto serialSetDtr(int64_t handle, int state, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return handleCall(handle, reporting(error_callback), [&] { return loopback().setDtr(handle, state != 0); });
+        });
+    }
+
+    auto serialSetRts(int64_t handle, int state, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return handleCall(handle, reporting(error_callback), [&] { return loopback().setRts(handle, state != 0); });
+        });
+    }
+
+    auto serialGetCts(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return modemCall(handle, reporting(error_callback), &Loopback::cts);
+        });
+    }
+
+    auto serialGetDsr(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return modemCall(handle, reporting(error_callback), &Loopback::dsr);
+        });
+    }
+
+    auto serialGetDcd(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return modemCall(handle, reporting(error_callback), &Loopback::dcd);
+        });
+    }
+
+    auto serialGetRi(int64_t handle, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return modemCall(handle, reporting(error_callback), &Loopback::ri);
+        });
+    }
+
+    auto serialSendBreak(int64_t handle, int duration_ms, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            const auto callback = reporting(error_callback);
+            if (duration_ms <= 0)
+            {
+                return cpp_core::failMsg<int>(callback, StatusCode::Control::kSendBreakError, "Invalid break duration");
+            }
+            return handleCall(handle, callback, [&] { return loopback().sendBreak(handle, duration_ms); });
+        });
+    }
+
+    auto serialGetWaitHandle(int64_t handle, ErrorCallbackT error_callback) -> int64_t
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int64_t {
+            const auto callback = reporting(error_callback);
+            if (const auto invalid = cpp_core::validateHandle<int64_t>(handle, callback); invalid < 0)
+            {
+                return invalid;
+            }
+            return cpp_core::toCResult(loopback().waitHandle(handle), callback);
+        });
+    }
+
+    auto serialPoll(cpp_core::PollEntry *entries, int entry_count, int timeout_ms, ErrorCallbackT error_callback)
+        -> int
+    {
+        return CPP_CORE_TRACED(0, [&] -> int {
+            const auto callback = reporting(error_callback);
+            if (entries == nullptr || entry_count <= 0)
+            {
+                return cpp_core::failMsg<int>(callback, StatusCode::Io::kBufferError, "Invalid entries or entry_count");
+            }
+            return cpp_core::toCResult(
+                loopback().poll(std::span(entries, static_cast<std::size_t>(entry_count)), timeout_ms), callback);
+        });
+    }
+
+    auto serialReadMany(cpp_core::ReadManyEntry *entries, int entry_count, int timeout_ms,
+                        ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(0, [&] -> int {
+            const auto callback = reporting(error_callback);
+            if (entries == nullptr || entry_count <= 0)
+            {
+                return cpp_core::failMsg<int>(callback, StatusCode::Io::kBufferError, "Invalid entries or entry_count");
+            }
+            const auto span = std::span(entries, static_cast<std::size_t>(entry_count));
+            const auto result = loopback().readMany(span, timeout_ms);
+            if (result)
+            {
+                for (const auto &entry : span)
+                {
+                    if (entry.result > 0)
+                    {
+                        loopback().notifyRead(entry.result);
+                    }
+                }
+            }
+            return cpp_core::toCResult(result, callback);
+        });
+    }
+
+    auto serialRxAcquire(int64_t handle, const void **data, int *size, int timeout_ms, ErrorCallbackT error_callback)
+        -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            const auto callback = reporting(error_callback);
+            if (data == nullptr || size == nullptr)
+            {
+                return cpp_core::failMsg<int>(callback, StatusCode::Io::kBufferError, "Invalid data or size");
+            }
+            *data = nullptr;
+            *size = 0;
+            return handleCall(handle, callback, [&] { return loopback().rxAcquire(handle, data, size, timeout_ms); });
+        });
+    }
+
+    auto serialRxRelease(int64_t handle, int consumed, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return handleCall(handle, reporting(error_callback),
+                              [&] { return loopback().rxRelease(handle, consumed); });
+        });
+    }
+
+    auto serialSetHandleReadCallback(int64_t handle, DataCallbackT callback_fn, void *user_data,
+                                     ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return handleCall(handle, reporting(error_callback),
+                              [&] { return loopback().setHandleReadCallback(handle, callback_fn, user_data); });
+        });
+    }
+
+    auto serialSetHandleWriteCallback(int64_t handle, DataCallbackT callback_fn, void *user_data,
+                                      ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(handle, [&] -> int {
+            return handleCall(handle, reporting(error_callback),
+                              [&] { return loopback().setHandleWriteCallback(handle, callback_fn, user_data); });
+        });
+    }
+
+    auto serialSubmit(const cpp_core::QueueSubmission *entries, int entry_count, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(0, [&] -> int {
+            const auto callback = reporting(error_callback);
+            if (entries == nullptr || entry_count <= 0)
+            {
+                return cpp_core::failMsg<int>(callback, StatusCode::Io::kBufferError, "Invalid entries or entry_count");
+            }
+            return cpp_core::toCResult(loopback().submit(std::span(entries, static_cast<std::size_t>(entry_count))),
+                                       callback);
+        });
+    }
+
+    auto serialReap(cpp_core::QueueCompletion *out, int capacity, int min_complete, int timeout_ms,
+                    ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(0, [&] -> int {
+            const auto callback = reporting(error_callback);
+            if (out == nullptr || capacity <= 0)
+            {
+                return cpp_core::failMsg<int>(callback, StatusCode::Io::kBufferError, "Invalid out or capacity");
+            }
+            const auto completions = std::span(out, static_cast<std::size_t>(capacity));
+            return cpp_core::toCResult(loopback().reap(completions, min_complete, timeout_ms), callback);
+        });
+    }
+
+    auto serialListPorts(void (*callback_fn)(const char *port, const char *path, const char *manufacturer,
+                                             const char *serial_number, const char *pnp_id, const char *location_id,
+                                             const char *product_id, const char *vendor_id),
+                         ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(0, [&] -> int {
+            return cpp_core::toCResult(loopback().listPorts(callback_fn), reporting(error_callback));
+        });
+    }
+
+    auto serialMonitorPorts(void (*callback_fn)(int event, const char *port), ErrorCallbackT /*error_callback*/)
+        -> int
+    {
+        return CPP_CORE_TRACED(0, [&] -> int {
+            loopback().monitorPorts(callback_fn);
+            return 0;
+        });
+    }
+
+    auto serialGetEventHandle(ErrorCallbackT error_callback) -> int64_t
+    {
+        return CPP_CORE_TRACED(0, [&] -> int64_t {
+            return cpp_core::toCResult(loopback().eventHandle(), reporting(error_callback));
+        });
+    }
+
+    auto serialDispatchEvents(int max_events, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(0, [&] -> int {
+            const auto callback = reporting(error_callback);
+            if (max_events <= 0)
+            {
+                return cpp_core::failMsg<int>(callback, StatusCode::Io::kBufferError, "max_events must be > 0");
+            }
+            return cpp_core::toCResult(loopback().dispatchEvents(max_events), callback);
+        });
+    }
+
+    void serialSetReadCallback(void (*callback_fn)(int bytes_read))
+    {
+        loopback().setReadCallback(callback_fn);
+    }
+
+    void serialSetWriteCallback(void (*callback_fn)(int bytes_written))
+    {
+        loopback().setWriteCallback(callback_fn);
+    }
+
+    void serialSetErrorCallback(ErrorCallbackT error_callback)
+    {
+        loopback().setErrorCallback(error_callback);
+    }
+
+    auto serialSetPoolOptions(int max_idle, int idle_timeout_ms, ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(0, [&] -> int {
+            return cpp_core::toCStatus(loopback().setPoolOptions(max_idle, idle_timeout_ms), reporting(error_callback));
+        });
+    }
+
+    auto serialClearPool(ErrorCallbackT error_callback) -> int
+    {
+        return CPP_CORE_TRACED(0, [&] -> int {
+            return cpp_core::toCResult(loopback().clearPool(), reporting(error_callback));
+        });
+    }
+
+    auto serialStatusName(int64_t code) -> const char *
+    {
+        return cpp_core::statusName(code);
+    }
+
+    auto serialStatusTable(cpp_core::StatusInfo *out, int capacity, ErrorCallbackT error_callback) -> int
+    {
+        if (capacity < 0 || (capacity > 0 && out == nullptr))
+        {
+            return cpp_core::failMsg<int>(reporting(error_callback), StatusCode::Io::kBufferError,
+                                          "Invalid out or capacity");
+        }
+        const auto table = cpp_core::statusTable();
+        std::copy_n(table.begin(), std::min(static_cast<std::size_t>(capacity), table.size()), out);
+        return static_cast<int>(table.size());
+    }
+
+    auto serialSetTracing(int enabled, ErrorCallbackT /*error_callback*/) -> int
+    {
+        cpp_core::trace::setEnabled(enabled != 0);
+        return 0;
+    }
+
+    auto serialTraceDump(const char *path, ErrorCallbackT error_callback) -> int
+    {
+        const auto callback = reporting(error_callback);
+        if (path == nullptr)
+        {
+            return cpp_core::failMsg<int>(callback, StatusCode::Io::kBufferError, "Path is nullptr");
+        }
+        const std::unique_ptr<std::FILE, decltype(&std::fclose)> file(std::fopen(path, "w"), &std::fclose);
+        if (!file)
+        {
+            return cpp_core::failMsg<int>(callback, StatusCode::Io::kWriteError, "Cannot open trace file");
+        }
+        return static_cast<int>(cpp_core::trace::writeChromeTrace(file.get()));
+    }
+
+} // extern "C"